@@ -67,6 +67,112 @@ template<> inline uint16_t HashFnv1a<uint16_t>(const char *input) {
   return (hash >> 16) ^ (hash & 0xffff);
 }
 
+// wyhash (final version 4, public domain, https://github.com/wangyi-fudan/wyhash):
+// processes 16 to 48 bytes per step using 64x64->128 bit multiplications.
+// Results do not depend on the host byte order.
+namespace wyhash_internal {
+
+static const uint64_t kSecret[4] = { 0x2d358dccaa6c78a5ULL,
+                                     0x8bb84b93962eacc9ULL,
+                                     0x4b33a62ed433d4a3ULL,
+                                     0x4d5a2da51de1aa47ULL };
+
+inline void Multiply(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = *a;
+  r *= *b;
+  *a = static_cast<uint64_t>(r);
+  *b = static_cast<uint64_t>(r >> 64);
+#else
+  uint64_t ha = *a >> 32, hb = *b >> 32, la = *a & 0xffffffff,
+           lb = *b & 0xffffffff;
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  uint64_t t = rl + (rm0 << 32), c = t < rl;
+  uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+  *a = lo;
+  *b = hi;
+#endif
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b) {
+  Multiply(&a, &b);
+  return a ^ b;
+}
+
+inline uint64_t Read8(const uint8_t *p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return EndianScalar(v);
+}
+
+inline uint64_t Read4(const uint8_t *p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return EndianScalar(v);
+}
+
+inline uint64_t Read3(const uint8_t *p, size_t k) {
+  return (static_cast<uint64_t>(p[0]) << 16) |
+         (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+
+}  // namespace wyhash_internal
+
+inline uint64_t HashWyhash64(const char *input, size_t length,
+                             uint64_t seed = 0) {
+  using namespace wyhash_internal;
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(input);
+  seed ^= Mix(seed ^ kSecret[0], kSecret[1]);
+  uint64_t a, b;
+  if (length <= 16) {
+    if (length >= 4) {
+      size_t shift = (length >> 3) << 2;
+      a = (Read4(p) << 32) | Read4(p + shift);
+      b = (Read4(p + length - 4) << 32) | Read4(p + length - 4 - shift);
+    } else if (length > 0) {
+      a = Read3(p, length);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t i = length;
+    if (i > 48) {
+      uint64_t seed1 = seed, seed2 = seed;
+      do {
+        seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+        seed1 = Mix(Read8(p + 16) ^ kSecret[2], Read8(p + 24) ^ seed1);
+        seed2 = Mix(Read8(p + 32) ^ kSecret[3], Read8(p + 40) ^ seed2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (i > 16) {
+      seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Read8(p + i - 16);
+    b = Read8(p + i - 8);
+  }
+  a ^= kSecret[1];
+  b ^= seed;
+  Multiply(&a, &b);
+  return Mix(a ^ kSecret[0] ^ length, b ^ kSecret[1]);
+}
+
+inline uint64_t HashWyhash64(const char *input) {
+  return HashWyhash64(input, std::strlen(input));
+}
+
+inline uint32_t HashWyhash32(const char *input) {
+  uint64_t hash = HashWyhash64(input);
+  return static_cast<uint32_t>(hash >> 32) ^ static_cast<uint32_t>(hash);
+}
+
 template<typename T> struct NamedHashFunction {
   const char *name;
 
@@ -82,11 +188,13 @@ const NamedHashFunction<uint16_t> kHashFunctions16[] = {
 const NamedHashFunction<uint32_t> kHashFunctions32[] = {
   { "fnv1_32", HashFnv1<uint32_t> },
   { "fnv1a_32", HashFnv1a<uint32_t> },
+  { "wyhash_32", HashWyhash32 },
 };
 
 const NamedHashFunction<uint64_t> kHashFunctions64[] = {
   { "fnv1_64", HashFnv1<uint64_t> },
   { "fnv1a_64", HashFnv1a<uint64_t> },
+  { "wyhash_64", HashWyhash64 },
 };
 
 inline NamedHashFunction<uint16_t>::HashFunction FindHashFunction16(
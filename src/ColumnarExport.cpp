@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarExport.h"
+
+#include <exception>
+#include <stdexcept>
+
+#include "SensorValuesLayout.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+using columnar::ColumnType;
+
+namespace {
+
+struct ExportContext {
+    ColumnarFileWriter& writer;
+    std::exception_ptr error;
+};
+
+bool exportVisitor(void* userData, const void* data, size_t size) {
+    ExportContext* context = static_cast<ExportContext*>(userData);
+    try {
+        SensorValues object;
+        SensorValuesFastDecoder::fromFlatBuffer(data, size, object);
+        addSensorValuesRow(context->writer, object);
+        return true;
+    } catch (...) {  // Do not let exceptions pass through the C API
+        context->error = std::current_exception();
+        return false;
+    }
+}
+
+}  // namespace
+
+std::vector<ColumnSpec> objectbox::tsdemo::sensorValuesColumns() {
+    return {{"id", ColumnType::Int64},
+            {"time", ColumnType::Int64},
+            {"temperatureOutside", ColumnType::Double},
+            {"temperatureInside", ColumnType::Double},
+            {"temperatureCpu", ColumnType::Double},
+            {"loadCpu1", ColumnType::Double},
+            {"loadCpu2", ColumnType::Double},
+            {"loadCpu3", ColumnType::Double},
+            {"loadCpu4", ColumnType::Double}};
+}
+
+void objectbox::tsdemo::addSensorValuesRow(ColumnarFileWriter& writer, const SensorValues& object) {
+    uint32_t row = writer.addRow();
+    writer.column<int64_t>(ColumnId)[row] = static_cast<int64_t>(object.id);
+    writer.column<int64_t>(ColumnTime)[row] = object.time;
+    writer.column<double>(ColumnTemperatureOutside)[row] = object.temperatureOutside;
+    writer.column<double>(ColumnTemperatureInside)[row] = object.temperatureInside;
+    writer.column<double>(ColumnTemperatureCpu)[row] = object.temperatureCpu;
+    writer.column<double>(ColumnLoadCpu1)[row] = object.loadCpu1;
+    writer.column<double>(ColumnLoadCpu2)[row] = object.loadCpu2;
+    writer.column<double>(ColumnLoadCpu3)[row] = object.loadCpu3;
+    writer.column<double>(ColumnLoadCpu4)[row] = object.loadCpu4;
+}
+
+uint64_t objectbox::tsdemo::exportSensorValues(const std::vector<SensorValues>& objects, const std::string& path) {
+    ColumnarFileWriter writer(path, sensorValuesColumns());
+    for (const SensorValues& object : objects) addSensorValuesRow(writer, object);
+    writer.close();
+    return writer.rowCount();
+}
+
+uint64_t objectbox::tsdemo::exportSensorValues(obx::Box<SensorValues>& box, const std::string& path,
+                                               int64_t timeBegin, int64_t timeEnd) {
+    obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+    queryBuilder.with(SensorValues_::time.between(timeBegin, timeEnd));
+    obx::Query<SensorValues> query = queryBuilder.build();
+
+    ColumnarFileWriter writer(path, sensorValuesColumns());
+    ExportContext context{writer, nullptr};
+    obx_err err = obx_query_visit(query.cPtr(), exportVisitor, &context);
+    if (context.error) std::rethrow_exception(context.error);
+    if (err != OBX_SUCCESS) throw std::runtime_error(std::string("Query failed: ") + obx_last_error_message());
+    writer.close();
+    return writer.rowCount();
+}
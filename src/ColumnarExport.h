@@ -0,0 +1,62 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_COLUMNAREXPORT_H
+#define OBJECTBOX_COLUMNAREXPORT_H
+
+#include <string>
+#include <vector>
+
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+#include "util/ColumnarFile.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Columns of exported SensorValues: one per property, with the same names and in the same order
+std::vector<ColumnSpec> sensorValuesColumns();
+
+/// Column indexes as returned by sensorValuesColumns()
+enum SensorValuesColumn {
+    ColumnId,
+    ColumnTime,
+    ColumnTemperatureOutside,
+    ColumnTemperatureInside,
+    ColumnTemperatureCpu,
+    ColumnLoadCpu1,
+    ColumnLoadCpu2,
+    ColumnLoadCpu3,
+    ColumnLoadCpu4
+};
+
+/// Adds the given object as a new row to a writer with the sensorValuesColumns()
+void addSensorValuesRow(ColumnarFileWriter& writer, const SensorValues& object);
+
+/// Writes the given objects to a new columnar file (e.g. to prepare an import)
+/// @returns the number of written objects
+uint64_t exportSensorValues(const std::vector<SensorValues>& objects, const std::string& path);
+
+/// Exports all SensorValues within the given time range (inclusive) to a columnar file (see ColumnarFile.h).
+/// Objects are streamed from the database, so only a single block of rows is held in memory.
+/// @returns the number of exported objects
+uint64_t exportSensorValues(obx::Box<SensorValues>& box, const std::string& path, int64_t timeBegin,
+                            int64_t timeEnd);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_COLUMNAREXPORT_H
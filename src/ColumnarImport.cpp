@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarImport.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "ColumnarExport.h"
+#include "util/ArenaAllocator.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+using columnar::ColumnType;
+
+SensorValuesColumnSource::SensorValuesColumnSource(const ColumnarFileReader& reader) : reader_(reader) {
+    std::vector<ColumnSpec> specs = sensorValuesColumns();
+    for (size_t i = 0; i < specs.size(); ++i) {
+        columns_[i] = reader.findColumn(specs[i].name.c_str());
+        if (i == ColumnId) continue;
+        if (columns_[i] < 0) throw std::runtime_error("Column missing: " + specs[i].name);
+        // Also checked by the reader; repeated here as the rows are read without any further checks
+        const columnar::ColumnDescriptor& column = reader.column(columns_[i]);
+        if (column.type != static_cast<uint32_t>(specs[i].type) || column.valueSize != 8) {
+            throw std::runtime_error("Column has an unexpected type or value size: " + specs[i].name);
+        }
+    }
+}
+
+void SensorValuesColumnSource::selectBlock(size_t block) {
+    time_ = reader_.columnData<int64_t>(block, columns_[ColumnTime]);
+    for (int i = 0; i < 7; ++i) doubles_[i] = reader_.columnData<double>(block, columns_[ColumnTemperatureOutside + i]);
+}
+
+void SensorValuesColumnSource::writeRow(flatbuffers::FlatBufferBuilder& fbb, size_t row, obx_id id) const {
+    // Same layout as the generated SensorValues binding (see ts-data-model.obx.cpp)
+    fbb.Clear();
+    flatbuffers::uoffset_t fbStart = fbb.StartTable();
+    fbb.AddElement<obx_id>(4, id);
+    fbb.AddElement(6, time_[row]);
+    for (int i = 0; i < 7; ++i) {
+        fbb.AddElement(static_cast<flatbuffers::voffset_t>(8 + 2 * i), doubles_[i][row]);
+    }
+    flatbuffers::Offset<flatbuffers::Table> offset;
+    offset.o = fbb.EndTable(fbStart);
+    fbb.Finish(offset);
+}
+
+uint64_t objectbox::tsdemo::importSensorValues(obx::Store& store, obx::Box<SensorValues>& box,
+                                               const std::string& path, size_t txBudgetBytes, size_t batchSize) {
+    ColumnarFileReader reader(path);
+    SensorValuesColumnSource source(reader);
+    ArenaAllocator allocator;
+    flatbuffers::FlatBufferBuilder fbb(1024, &allocator);
+    fbb.ForceDefaults(true);  // ObjectBox patches the new ID into the (always present) id field
+
+    uint64_t rowCount = 0;
+    for (size_t i = 0; i < reader.blockCount(); ++i) rowCount += reader.blockRowCount(i);
+
+    // Buffers of the current batch back-to-back (each 8 byte aligned) for obx_box_put_many()
+    std::vector<uint64_t> region;  // uint64_t for alignment
+    std::vector<size_t> sizes;
+    std::vector<OBX_bytes> objects;
+    std::vector<obx_id> ids;
+
+    uint64_t imported = 0;
+    size_t block = 0;
+    size_t row = 0;
+    auto nextNonEmptyBlock = [&]() {
+        while (block < reader.blockCount() && reader.blockRowCount(block) == 0) block++;
+        if (block < reader.blockCount()) source.selectBlock(block);
+    };
+    auto nextRow = [&]() {
+        if (++row == reader.blockRowCount(block)) {
+            row = 0;
+            block++;
+            nextNonEmptyBlock();
+        }
+    };
+    nextNonEmptyBlock();
+    while (imported < rowCount) {
+        obx::Transaction tx = store.txWrite();
+        size_t txBytes = 0;
+        while (imported < rowCount && txBytes < txBudgetBytes) {
+            if (batchSize <= 1) {  // one C API call per object
+                source.writeRow(fbb, row);
+                obx_id id = obx_box_put_object4(box.cPtr(), fbb.GetBufferPointer(), fbb.GetSize(), OBXPutMode_PUT);
+                if (id == 0) throw std::runtime_error(std::string("Put failed: ") + obx_last_error_message());
+                txBytes += fbb.GetSize();
+                imported++;
+                nextRow();
+                continue;
+            }
+
+            // Reserve the IDs of the batch upfront so they can be written into the buffers (like putBatch())
+            size_t count = static_cast<size_t>(std::min<uint64_t>(batchSize, rowCount - imported));
+            obx_id firstId = 0;
+            if (obx_box_ids_for_put(box.cPtr(), count, &firstId) != OBX_SUCCESS) {
+                throw std::runtime_error(std::string("Could not reserve IDs: ") + obx_last_error_message());
+            }
+            region.clear();
+            sizes.clear();
+            ids.clear();
+            for (size_t i = 0; i < count; ++i) {
+                source.writeRow(fbb, row, firstId + i);
+                size_t offset = region.size();
+                region.resize(offset + (fbb.GetSize() + 7) / 8);
+                memcpy(region.data() + offset, fbb.GetBufferPointer(), fbb.GetSize());
+                sizes.push_back(fbb.GetSize());
+                ids.push_back(firstId + i);
+                txBytes += fbb.GetSize();
+                nextRow();
+            }
+            objects.clear();
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(region.data());
+            for (size_t size : sizes) {
+                objects.push_back(OBX_bytes{data, size});
+                data += (size + 7) / 8 * 8;
+            }
+            OBX_bytes_array bytesArray{objects.data(), objects.size()};
+            if (obx_box_put_many(box.cPtr(), &bytesArray, ids.data(), OBXPutMode_PUT) != OBX_SUCCESS) {
+                throw std::runtime_error(std::string("Put failed: ") + obx_last_error_message());
+            }
+            imported += count;
+        }
+        tx.success();
+    }
+    return imported;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_COLUMNARIMPORT_H
+#define OBJECTBOX_COLUMNARIMPORT_H
+
+#include <string>
+
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+#include "util/ColumnarFile.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Reads SensorValues rows from the mapped column arrays of a columnar file (as written by exportSensorValues()).
+/// Columns are looked up by property name; the id column is ignored as imported objects get new IDs.
+class SensorValuesColumnSource {
+    const ColumnarFileReader& reader_;
+    int columns_[9];
+    const int64_t* time_ = nullptr;
+    const double* doubles_[7] = {};
+
+public:
+    /// Throws std::runtime_error if a property column (other than id) is missing or has the wrong type/value size
+    explicit SensorValuesColumnSource(const ColumnarFileReader& reader);
+
+    /// Makes the given block the current one for writeRow()
+    void selectBlock(size_t block);
+
+    /// Writes the given row of the current block as a complete SensorValues FlatBuffer with the given ID
+    /// (by default a new ID, which ObjectBox assigns on put)
+    void writeRow(flatbuffers::FlatBufferBuilder& fbb, size_t row, obx_id id = OBX_ID_NEW) const;
+};
+
+/// Imports all rows of a columnar file into the given box as new SensorValues objects.
+/// FlatBuffers are built directly from the memory-mapped column arrays (no SensorValues objects are created) and
+/// put in write transactions, each committed once its object data exceeds txBudgetBytes.
+/// Objects are put in batches of batchSize via obx_box_put_many() with IDs reserved upfront (like putBatch());
+/// a batchSize of 1 puts each object with its own obx_box_put_object4() call.
+/// @returns the number of imported objects
+uint64_t importSensorValues(obx::Store& store, obx::Box<SensorValues>& box, const std::string& path,
+                            size_t txBudgetBytes = 64 * 1024 * 1024, size_t batchSize = 10000);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_COLUMNARIMPORT_H
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022-2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DemoData.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace objectbox::tsdemo;
+
+int64_t objectbox::tsdemo::millisSinceEpoch() {
+    auto time = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
+}
+
+SensorValues SensorValuesGenerator::next() {
+    delta_ += deltaDelta_;
+    value_ += delta_;
+    if ((delta_ > 0.01 && deltaDelta_ > 0) || (delta_ < -0.01 && deltaDelta_ < 0)) {
+        deltaDelta_ = -deltaDelta_;
+    }
+    double value = value_;
+    SensorValues sensorValues{OBX_ID_NEW,
+                              time_,
+                              19.5 + value,
+                              23.3 + value * cos(value),
+                              42.75 + value * sin(value),
+                              0.80 - value,
+                              0.7 - value,
+                              0.6 - value,
+                              0.5 - value};
+    time_ += intervalMillis_;
+    return sensorValues;
+}
+
+void SensorValuesGenerator::next(std::vector<SensorValues>& out, size_t count) {
+    out.clear();
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i) out.push_back(next());
+}
+
+std::vector<SensorValues> objectbox::tsdemo::createSensorValueData(int64_t now, int dataCount, bool logProgress) {
+    std::vector<SensorValues> values;
+    values.reserve(dataCount);
+    SensorValuesGenerator generator(now - 1000 + 20);
+    for (int i = 1; i <= dataCount; ++i) {
+        values.push_back(generator.next());
+        if (logProgress && i % 100000 == 0) {
+            std::cout << "index " << i << ": v=" << generator.value() << ", delta=" << generator.delta() << std::endl;
+        }
+    }
+    return values;
+}
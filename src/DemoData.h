@@ -0,0 +1,63 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_DEMODATA_H
+#define OBJECTBOX_DEMODATA_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+int64_t millisSinceEpoch();
+
+/// Generates the dummy sensor data of createSensorValueData() incrementally, e.g. for data sets too large for memory:
+/// one object every intervalMillis (with new IDs) starting at firstTime
+class SensorValuesGenerator {
+    int64_t time_;
+    int64_t intervalMillis_;
+    double deltaDelta_ = 0.000001;
+    double delta_ = 0.0;
+    double value_ = 0.0;
+
+public:
+    explicit SensorValuesGenerator(int64_t firstTime, int64_t intervalMillis = 20)
+        : time_(firstTime), intervalMillis_(intervalMillis) {}
+
+    SensorValues next();
+
+    /// Replaces the content of the given vector with the next count objects
+    void next(std::vector<SensorValues>& out, size_t count);
+
+    /// Time of the object returned by the next call to next()
+    int64_t nextTime() const { return time_; }
+
+    /// Current base value of the generated curve (from which the properties are derived)
+    double value() const { return value_; }
+
+    double delta() const { return delta_; }
+};
+
+/// Creates dummy sensor data with new IDs: one object every 20 ms starting about one second before now
+std::vector<SensorValues> createSensorValueData(int64_t now, int dataCount, bool logProgress = true);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_DEMODATA_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DemoSchema.h"
+
+using namespace objectbox::tsdemo;
+
+namespace {
+
+struct FieldSpec {
+    const char* name;
+    reflection::BaseType type;
+    reflection::BaseType element;  // for vectors
+
+    FieldSpec(const char* name, reflection::BaseType type, reflection::BaseType element = reflection::None)
+        : name(name), type(type), element(element) {}
+};
+
+flatbuffers::Offset<reflection::Object> createObject(flatbuffers::FlatBufferBuilder& fbb, const char* name,
+                                                     const std::vector<FieldSpec>& specs) {
+    std::vector<flatbuffers::Offset<reflection::Field>> fields;
+    for (size_t id = 0; id < specs.size(); ++id) {
+        const FieldSpec& spec = specs[id];
+        size_t size = flatbuffers::GetTypeSize(spec.type);  // for strings and vectors, the size of the offset
+        size_t elementSize = spec.type == reflection::Vector ? flatbuffers::GetTypeSize(spec.element) : 0;
+        auto type = reflection::CreateType(fbb, spec.type, spec.element, -1, 0, static_cast<uint32_t>(size),
+                                           static_cast<uint32_t>(elementSize));
+        auto offset = static_cast<uint16_t>(flatbuffers::FieldIndexToOffset(static_cast<flatbuffers::voffset_t>(id)));
+        fields.push_back(reflection::CreateFieldDirect(fbb, spec.name, type, static_cast<uint16_t>(id), offset));
+    }
+    return reflection::CreateObjectDirect(fbb, name, &fields);  // sorts the fields by name
+}
+
+}  // namespace
+
+std::vector<uint8_t> objectbox::tsdemo::buildDemoSchema() {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<reflection::Object>> objects;
+    objects.push_back(createObject(fbb, "objectbox.tsdemo.SensorValues",
+                                   {{"id", reflection::ULong},
+                                    {"time", reflection::Long},
+                                    {"temperatureOutside", reflection::Double},
+                                    {"temperatureInside", reflection::Double},
+                                    {"temperatureCpu", reflection::Double},
+                                    {"loadCpu1", reflection::Double},
+                                    {"loadCpu2", reflection::Double},
+                                    {"loadCpu3", reflection::Double},
+                                    {"loadCpu4", reflection::Double}}));
+    objects.push_back(createObject(fbb, "objectbox.tsdemo.NamedTimeRange",
+                                   {{"id", reflection::ULong},
+                                    {"begin", reflection::Long},
+                                    {"end", reflection::Long},
+                                    {"name", reflection::String}}));
+    objects.push_back(createObject(fbb, "objectbox.tsdemo.SensorValuesQuantized",
+                                   {{"id", reflection::ULong},
+                                    {"time", reflection::Long},
+                                    {"temperatureOutside", reflection::Short},
+                                    {"temperatureInside", reflection::Double},
+                                    {"temperatureCpu", reflection::Double},
+                                    {"loadCpu1", reflection::Float},
+                                    {"loadCpu2", reflection::Float},
+                                    {"loadCpu3", reflection::Float},
+                                    {"loadCpu4", reflection::Float}}));
+    objects.push_back(createObject(fbb, "objectbox.tsdemo.SensorValuesPacked",
+                                   {{"id", reflection::ULong},
+                                    {"time", reflection::Long},
+                                    {"payload", reflection::Vector, reflection::Double}}));
+    std::vector<flatbuffers::Offset<reflection::Enum>> enums;  // required, even if empty
+    fbb.Finish(reflection::CreateSchemaDirect(fbb, &objects, &enums), reflection::SchemaIdentifier());
+    return std::vector<uint8_t>(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+}
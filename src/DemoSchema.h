@@ -0,0 +1,36 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_DEMOSCHEMA_H
+#define OBJECTBOX_DEMOSCHEMA_H
+
+#include <cstdint>
+#include <vector>
+
+#include "flatbuffers/reflection.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Builds a reflection::Schema (binary, like a .bfbs file) for the entities of ts-data-model.fbs.
+/// The ObjectBox generator does not emit .bfbs files, so it is built with the reflection builders;
+/// keep it in sync with ts-data-model.fbs. Use reflection::GetSchema() on the returned buffer.
+std::vector<uint8_t> buildDemoSchema();
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_DEMOSCHEMA_H
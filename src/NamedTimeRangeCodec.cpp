@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NamedTimeRangeCodec.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+void readTable(const flatbuffers::Table* table, InternedNamedTimeRange& outObject, StringPool& pool) {
+    outObject.id = table->GetField<obx_id>(4, 0);
+    outObject.begin = table->GetField<int64_t>(6, 0);
+    outObject.end = table->GetField<int64_t>(8, 0);
+    const flatbuffers::String* name = table->GetPointer<const flatbuffers::String*>(10);
+    outObject.name = name ? pool.intern(name->c_str(), name->size()) : InternedString();
+}
+
+}  // namespace
+
+void NamedTimeRangeCodec::fromFlatBuffer(const void* data, size_t, InternedNamedTimeRange& outObject,
+                                         StringPool& pool) {
+    const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+    assert(table);
+    readTable(table, outObject, pool);
+}
+
+NamedTimeRange NamedTimeRangeCodec::toNamedTimeRange(const InternedNamedTimeRange& object) {
+    return NamedTimeRange{object.id, object.begin, object.end, object.name.str()};
+}
+
+void NamedTimeRangeCodec::toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const NamedTimeRange* objects,
+                                       size_t count, bool shareNames) {
+    fbb.Clear();
+    std::vector<flatbuffers::Offset<flatbuffers::Table>> tables;
+    tables.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const NamedTimeRange& object = objects[i];
+        auto offsetName = shareNames ? fbb.CreateSharedString(object.name) : fbb.CreateString(object.name);
+        flatbuffers::uoffset_t fbStart = fbb.StartTable();
+        fbb.AddElement(4, object.id);
+        fbb.AddElement(6, object.begin);
+        fbb.AddElement(8, object.end);
+        fbb.AddOffset(10, offsetName);
+        tables.push_back(flatbuffers::Offset<flatbuffers::Table>(fbb.EndTable(fbStart)));
+    }
+    fbb.Finish(fbb.CreateVector(tables));
+}
+
+void NamedTimeRangeCodec::fromFlatBuffer(const void* data, size_t, std::vector<InternedNamedTimeRange>& outObjects,
+                                         StringPool& pool) {
+    const auto* tables = flatbuffers::GetRoot<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::Table>>>(data);
+    outObjects.resize(tables->size());
+    for (flatbuffers::uoffset_t i = 0; i < tables->size(); ++i) readTable(tables->Get(i), outObjects[i], pool);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_NAMEDTIMERANGECODEC_H
+#define OBJECTBOX_NAMEDTIMERANGECODEC_H
+
+#include <vector>
+
+#include "ts-data-model.obx.hpp"
+#include "util/StringPool.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// NamedTimeRange referencing its name in a StringPool: typically there are only a few distinct names, so decoding
+/// does not allocate and all objects with the same name share one immutable string.
+struct InternedNamedTimeRange {
+    obx_id id;
+    int64_t begin;
+    int64_t end;
+    InternedString name;
+};
+
+/// Alternative (de)serialization for NamedTimeRange objects with interned/shared names.
+struct NamedTimeRangeCodec {
+    /// Read an object from a valid NamedTimeRange FlatBuffer; the name is interned in the given pool
+    static void fromFlatBuffer(const void* data, size_t size, InternedNamedTimeRange& outObject,
+                               StringPool& pool = StringPool::global());
+
+    static NamedTimeRange toNamedTimeRange(const InternedNamedTimeRange& object);
+
+    /// Writes all objects into a single FlatBuffer (root: vector of NamedTimeRange tables), e.g. for bulk transfer.
+    /// ObjectBox stores each object as its own FlatBuffer; here, names can be shared across objects:
+    /// @param shareNames write each distinct name only once (via FlatBufferBuilder::CreateSharedString())
+    static void toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const NamedTimeRange* objects, size_t count,
+                             bool shareNames);
+
+    /// Read all objects from a valid FlatBuffer written by toFlatBuffer(fbb, objects, count, shareNames)
+    static void fromFlatBuffer(const void* data, size_t size, std::vector<InternedNamedTimeRange>& outObjects,
+                               StringPool& pool = StringPool::global());
+};
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_NAMEDTIMERANGECODEC_H
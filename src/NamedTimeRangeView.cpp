@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NamedTimeRangeView.h"
+
+#include <exception>
+#include <stdexcept>
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+struct VisitContext {
+    const NamedTimeRangeVisitor& visitor;
+    uint64_t count;
+    std::exception_ptr error;
+};
+
+bool viewVisitor(void* userData, const void* data, size_t size) {
+    VisitContext* context = static_cast<VisitContext*>(userData);
+    try {
+        context->count++;
+        return context->visitor(NamedTimeRangeView::fromFlatBuffer(data, size));
+    } catch (...) {  // Do not let exceptions pass through the C API
+        context->error = std::current_exception();
+        return false;
+    }
+}
+
+uint64_t finishVisit(obx_err err, VisitContext& context) {
+    if (context.error) std::rethrow_exception(context.error);
+    if (err != OBX_SUCCESS) throw std::runtime_error(std::string("Visiting failed: ") + obx_last_error_message());
+    return context.count;
+}
+
+}  // namespace
+
+uint64_t objectbox::tsdemo::visitNamedTimeRanges(obx::Query<NamedTimeRange>& query,
+                                                 const NamedTimeRangeVisitor& visitor) {
+    VisitContext context{visitor, 0, nullptr};
+    return finishVisit(obx_query_visit(query.cPtr(), viewVisitor, &context), context);
+}
+
+uint64_t objectbox::tsdemo::visitNamedTimeRanges(obx::Box<NamedTimeRange>& box, const NamedTimeRangeVisitor& visitor) {
+    VisitContext context{visitor, 0, nullptr};
+    return finishVisit(obx_box_visit_all(box.cPtr(), viewVisitor, &context), context);
+}
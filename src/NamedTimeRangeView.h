@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_NAMEDTIMERANGEVIEW_H
+#define OBJECTBOX_NAMEDTIMERANGEVIEW_H
+
+#include <functional>
+
+#include "ts-data-model.obx.hpp"
+#include "util/StringView.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Read-only NamedTimeRange referencing the FlatBuffer it was read from, i.e. reading does not copy or allocate.
+/// Only valid as long as that data is; for ObjectBox data that is the read transaction (e.g. the visitor call).
+struct NamedTimeRangeView {
+    obx_id id;
+    int64_t begin;
+    int64_t end;
+    StringView name;
+
+    /// Read a view from a valid NamedTimeRange FlatBuffer
+    static NamedTimeRangeView fromFlatBuffer(const void* data, size_t) {
+        const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+        assert(table);
+        const flatbuffers::String* name = table->GetPointer<const flatbuffers::String*>(10);
+        return NamedTimeRangeView{table->GetField<obx_id>(4, 0), table->GetField<int64_t>(6, 0),
+                                  table->GetField<int64_t>(8, 0),
+                                  name ? StringView(name->c_str(), name->size()) : StringView()};
+    }
+
+    /// Copies the data into an owning object
+    NamedTimeRange toNamedTimeRange() const { return NamedTimeRange{id, begin, end, name.str()}; }
+};
+
+/// Return false to stop visiting
+typedef std::function<bool(const NamedTimeRangeView& object)> NamedTimeRangeVisitor;
+
+/// Calls the visitor with a view of each query result, all within a single read transaction
+/// @returns the number of visited objects
+uint64_t visitNamedTimeRanges(obx::Query<NamedTimeRange>& query, const NamedTimeRangeVisitor& visitor);
+
+/// Calls the visitor with a view of each object in the box, all within a single read transaction
+/// @returns the number of visited objects
+uint64_t visitNamedTimeRanges(obx::Box<NamedTimeRange>& box, const NamedTimeRangeVisitor& visitor);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_NAMEDTIMERANGEVIEW_H
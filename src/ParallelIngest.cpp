@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelIngest.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "util/StopWatch.h"
+#include "util/Tracing.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+ParallelSerializer::ParallelSerializer(unsigned threadCount, size_t chunkSize, size_t maxChunksInFlight)
+    : threadCount_(std::max(1u, threadCount)),
+      chunkSize_(std::max<size_t>(1, chunkSize)),
+      maxChunksInFlight_(maxChunksInFlight ? maxChunksInFlight : 2 * threadCount_) {}
+
+void ParallelSerializer::run(const SensorValues* values, size_t count, const ChunkConsumer& consumer) {
+    size_t chunkCount = (count + chunkSize_ - 1) / chunkSize_;
+    size_t slotCount = std::min(maxChunksInFlight_, std::max<size_t>(1, chunkCount));
+    std::vector<SensorValuesBatch> slots(slotCount);
+    std::vector<size_t> slotChunk(slotCount, SIZE_MAX);  // chunk index ready in the slot
+
+    std::mutex mutex;
+    std::condition_variable chunkReady;     // signals the consumer
+    std::condition_variable slotAvailable;  // signals the workers
+    size_t nextChunk = 0;                   // next chunk to be taken by a worker
+    size_t consumedChunks = 0;
+    bool stop = false;
+    std::exception_ptr error;
+
+    auto worker = [&](unsigned index) {
+        if (Tracer::enabled()) Tracer::setThreadName("serializer " + std::to_string(index));
+        while (true) {
+            size_t chunk;
+            {
+                TraceScope waitScope("wait for slot");
+                std::unique_lock<std::mutex> lock(mutex);
+                // A slot can be reused once its previous chunk was consumed
+                slotAvailable.wait(lock, [&] { return stop || nextChunk < consumedChunks + slotCount; });
+                if (stop || nextChunk >= chunkCount) return;
+                chunk = nextChunk++;
+            }
+            try {
+                TraceScope scope("serialize chunk", "chunk", static_cast<int64_t>(chunk));
+                size_t first = chunk * chunkSize_;
+                slots[chunk % slotCount].serialize(values + first, std::min(chunkSize_, count - first));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) error = std::current_exception();
+                stop = true;
+                chunkReady.notify_one();
+                slotAvailable.notify_all();
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            slotChunk[chunk % slotCount] = chunk;
+            chunkReady.notify_one();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount_; ++i) threads.emplace_back(worker, i);
+
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        size_t slot = chunk % slotCount;
+        {
+            TraceScope waitScope("wait for chunk");
+            std::unique_lock<std::mutex> lock(mutex);
+            chunkReady.wait(lock, [&] { return stop || slotChunk[slot] == chunk; });
+            if (stop) break;
+        }
+        try {
+            TraceScope scope("consume chunk", "chunk", static_cast<int64_t>(chunk));
+            consumer(slots[slot]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) error = std::current_exception();
+            stop = true;
+            slotAvailable.notify_all();
+            break;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        consumedChunks = chunk + 1;
+        slotAvailable.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+        slotAvailable.notify_all();
+    }
+    for (std::thread& thread : threads) thread.join();
+    if (error) std::rethrow_exception(error);
+}
+
+obx_id objectbox::tsdemo::putParallel(obx::Store& store, obx::Box<SensorValues>& box,
+                                      const std::vector<SensorValues>& values, unsigned threadCount,
+                                      LatencyHistogram* putLatency) {
+    obx_id firstId = 0;
+    obx::Transaction tx = store.txWrite();  // used by all puts of this (the writer) thread
+    ParallelSerializer serializer(threadCount);
+    serializer.run(values.data(), values.size(), [&](SensorValuesBatch& chunk) {
+        StopWatch stopWatch;
+        obx_id id = putBatch(box, chunk);
+        if (putLatency) putLatency->record(stopWatch);
+        if (firstId == 0) firstId = id;
+    });
+    tx.success();
+    return firstId;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_PARALLELINGEST_H
+#define OBJECTBOX_PARALLELINGEST_H
+
+#include <functional>
+
+#include "SensorValuesBatch.h"
+#include "util/LatencyHistogram.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Serializes SensorValues in chunks on worker threads and hands the serialized chunks to the calling thread in order,
+/// e.g. to put them in a single write transaction while the workers already serialize the following chunks.
+/// At most maxChunksInFlight chunks are buffered; their memory is reused for later chunks.
+class ParallelSerializer {
+    unsigned threadCount_;
+    size_t chunkSize_;
+    size_t maxChunksInFlight_;
+
+public:
+    /// Called on the calling thread of run() for each chunk; the chunk is only valid during the call
+    typedef std::function<void(SensorValuesBatch& chunk)> ChunkConsumer;
+
+    /// @param maxChunksInFlight 0 for a default based on the thread count
+    explicit ParallelSerializer(unsigned threadCount, size_t chunkSize = 16 * 1024, size_t maxChunksInFlight = 0);
+
+    /// Serializes all values and passes them to the consumer chunk by chunk (in the order of the values).
+    /// If a worker or the consumer throws, processing stops and the (first) exception is rethrown.
+    void run(const SensorValues* values, size_t count, const ChunkConsumer& consumer);
+};
+
+/// Puts all values as new objects in a single write transaction: threadCount workers serialize, while the calling
+/// thread is the single writer committing the prebuilt buffers (see putBatch()).
+/// @param putLatency optional; records the duration of each chunk's put
+/// @returns the ID of the first object; the objects get consecutive IDs (the given values are not modified)
+obx_id putParallel(obx::Store& store, obx::Box<SensorValues>& box, const std::vector<SensorValues>& values,
+                   unsigned threadCount, LatencyHistogram* putLatency = nullptr);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_PARALLELINGEST_H
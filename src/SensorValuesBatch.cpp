@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesBatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#include "SensorValuesColumns.h"
+#include "SensorValuesLayout.h"
+#include "util/ArenaAllocator.h"
+#include "util/Tracing.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+typedef SensorValuesLayout L;
+
+/// Rows of an object array or of columns (read as SensorValues; for columns, this is inlined to plain loads)
+struct ObjectRows {
+    const SensorValues* objects;
+    const SensorValues& operator()(size_t index) const { return objects[index]; }
+};
+
+struct ColumnRows {
+    const SensorValuesColumns& columns;
+    SensorValues operator()(size_t index) const { return columns.row(index); }
+};
+
+/// Serializes the rows [start, start + count) to the slots beginning at region
+template <typename Rows>
+void serializeSlice(Rows rows, size_t start, size_t count, uint8_t* region, size_t slotSize) {
+    TraceScope scope("serialize slice", "objects", static_cast<int64_t>(count));
+    const SensorValuesLayout& layout = SensorValuesLayout::get();
+    const uint8_t* bufferTemplate = layout.bufferTemplate().data();
+    size_t templateSize = layout.bufferTemplate().size();
+    size_t tableOffset = layout.tableOffset();
+    for (size_t i = 0; i < count; ++i) {
+        const SensorValues& object = rows(start + i);
+        uint8_t* buffer = region + i * slotSize;
+        memcpy(buffer, bufferTemplate, templateSize);
+        uint8_t* table = buffer + tableOffset;
+        flatbuffers::WriteScalar(table + L::fieldOffset(0), object.id);
+        flatbuffers::WriteScalar(table + L::fieldOffset(1), object.time);
+        flatbuffers::WriteScalar(table + L::fieldOffset(2), object.temperatureOutside);
+        flatbuffers::WriteScalar(table + L::fieldOffset(3), object.temperatureInside);
+        flatbuffers::WriteScalar(table + L::fieldOffset(4), object.temperatureCpu);
+        flatbuffers::WriteScalar(table + L::fieldOffset(5), object.loadCpu1);
+        flatbuffers::WriteScalar(table + L::fieldOffset(6), object.loadCpu2);
+        flatbuffers::WriteScalar(table + L::fieldOffset(7), object.loadCpu3);
+        flatbuffers::WriteScalar(table + L::fieldOffset(8), object.loadCpu4);
+    }
+}
+
+}  // namespace
+
+template <typename Rows>
+void SensorValuesBatch::serializeRows(Rows rows, size_t count, unsigned threadCount) {
+    const SensorValuesLayout& layout = SensorValuesLayout::get();
+    if (!layout.valid()) {
+        serializeGeneric(rows, count);
+        return;
+    }
+    size_t bufferSize = layout.bufferTemplate().size();
+    size_t slotSize = (bufferSize + 7) / 8 * 8;
+    region_.resize(count * slotSize / 8);
+    uint8_t* region = reinterpret_cast<uint8_t*>(region_.data());
+    objects_.resize(count);
+    for (size_t i = 0; i < count; ++i) objects_[i] = OBX_bytes{region + i * slotSize, bufferSize};
+
+    if (threadCount <= 1 || count < 2 * threadCount) {
+        serializeSlice(rows, 0, count, region, slotSize);
+        return;
+    }
+    std::vector<std::thread> threads;
+    size_t sliceSize = (count + threadCount - 1) / threadCount;
+    for (size_t start = 0; start < count; start += sliceSize) {
+        size_t sliceCount = std::min(sliceSize, count - start);
+        threads.emplace_back(serializeSlice<Rows>, rows, start, sliceCount, region + start * slotSize, slotSize);
+    }
+    for (std::thread& thread : threads) thread.join();
+}
+
+template <typename Rows>
+void SensorValuesBatch::serializeGeneric(Rows rows, size_t count) {
+    ArenaAllocator allocator;  // builder memory from the thread's arena instead of the heap
+    flatbuffers::FlatBufferBuilder fbb(1024, &allocator);
+    fbb.ForceDefaults(true);
+    region_.clear();
+    std::vector<size_t> offsets;
+    offsets.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, rows(i));
+        offsets.push_back(region_.size() * 8);
+        region_.resize(region_.size() + (fbb.GetSize() + 7) / 8);
+        memcpy(reinterpret_cast<uint8_t*>(region_.data()) + offsets.back(), fbb.GetBufferPointer(), fbb.GetSize());
+    }
+    // Pointers only after all resizes of the region
+    uint8_t* region = reinterpret_cast<uint8_t*>(region_.data());
+    objects_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t end = i + 1 < count ? offsets[i + 1] : region_.size() * 8;
+        objects_[i] = OBX_bytes{region + offsets[i], end - offsets[i]};
+    }
+}
+
+void SensorValuesBatch::serialize(const SensorValues* objects, size_t count, unsigned threadCount) {
+    serializeRows(ObjectRows{objects}, count, threadCount);
+}
+
+void SensorValuesBatch::serialize(const SensorValuesColumns& columns, unsigned threadCount) {
+    serializeRows(ColumnRows{columns}, columns.size(), threadCount);
+}
+
+size_t SensorValuesBatch::sizeInBytes() const {
+    size_t size = 0;
+    for (const OBX_bytes& object : objects_) size += object.size;
+    return size;
+}
+
+void SensorValuesBatch::setIds(obx_id firstId) {
+    for (size_t i = 0; i < objects_.size(); ++i) {
+        uint8_t* data = static_cast<uint8_t*>(const_cast<void*>(objects_[i].data));
+        auto* table = flatbuffers::GetMutableRoot<flatbuffers::Table>(data);
+        if (!table->SetField<obx_id>(4, firstId + i, 0)) throw std::logic_error("Object data has no ID field");
+    }
+}
+
+obx_id objectbox::tsdemo::putBatch(obx::Box<SensorValues>& box, SensorValuesBatch& batch) {
+    if (batch.count() == 0) return 0;
+    obx_id firstId = 0;
+    if (obx_box_ids_for_put(box.cPtr(), batch.count(), &firstId) != OBX_SUCCESS) {
+        throw std::runtime_error(std::string("Could not reserve IDs: ") + obx_last_error_message());
+    }
+    batch.setIds(firstId);
+    std::vector<obx_id> ids(batch.count());
+    for (size_t i = 0; i < ids.size(); ++i) ids[i] = firstId + i;
+    OBX_bytes_array objects = batch.bytesArray();
+    if (obx_box_put_many(box.cPtr(), &objects, ids.data(), OBXPutMode_PUT) != OBX_SUCCESS) {
+        throw std::runtime_error(std::string("Put failed: ") + obx_last_error_message());
+    }
+    return firstId;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESBATCH_H
+#define OBJECTBOX_SENSORVALUESBATCH_H
+
+#include <vector>
+
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+struct SensorValuesColumns;
+
+/// Many serialized SensorValues in one contiguous region: complete FlatBuffers back-to-back (each 8 byte aligned)
+/// and an OBX_bytes array pointing at them, e.g. for obx_box_put_many() (see putBatch()).
+/// With the fixed SensorValuesLayout, all buffers have the same size, so the region is sized upfront and each
+/// object is written by copying a template buffer and setting its fields; thus slices can be written in parallel.
+class SensorValuesBatch {
+    std::vector<uint64_t> region_;  // uint64_t for alignment
+    std::vector<OBX_bytes> objects_;
+
+    template <typename Rows>
+    void serializeRows(Rows rows, size_t count, unsigned threadCount);
+
+    template <typename Rows>
+    void serializeGeneric(Rows rows, size_t count);
+
+public:
+    /// Serializes the given objects (replacing previous content); slices are serialized by threadCount threads.
+    /// Falls back to the generated binding (single threaded) if the layout differs from SensorValuesLayout.
+    void serialize(const SensorValues* objects, size_t count, unsigned threadCount = 1);
+
+    void serialize(const std::vector<SensorValues>& objects, unsigned threadCount = 1) {
+        serialize(objects.data(), objects.size(), threadCount);
+    }
+
+    /// Serializes all rows of the given columns (see serialize(objects, count, threadCount))
+    void serialize(const SensorValuesColumns& columns, unsigned threadCount = 1);
+
+    size_t count() const { return objects_.size(); }
+
+    /// Total size of all serialized objects (excluding alignment padding)
+    size_t sizeInBytes() const;
+
+    const OBX_bytes& object(size_t index) const { return objects_[index]; }
+
+    /// Points to the internal OBX_bytes; valid until the batch is changed
+    OBX_bytes_array bytesArray() { return OBX_bytes_array{objects_.data(), objects_.size()}; }
+
+    /// Sets consecutive IDs starting with firstId in the serialized objects (e.g. from obx_box_ids_for_put())
+    void setIds(obx_id firstId);
+};
+
+/// Puts all objects of the batch as new objects using consecutive IDs (sets them in the batch)
+/// @returns the ID of the first object
+obx_id putBatch(obx::Box<SensorValues>& box, SensorValuesBatch& batch);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESBATCH_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesColumns.h"
+
+#include <exception>
+#include <stdexcept>
+
+#include "SensorValuesBatch.h"
+#include "SensorValuesLayout.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+struct ResizeColumn {
+    SensorValuesColumns& columns;
+    size_t count;
+
+    template <typename Field>
+    void operator()(Field field) const {
+        columns.column(field).resize(count);
+    }
+};
+
+struct FindContext {
+    SensorValuesColumns& columns;
+    uint64_t count;
+    std::exception_ptr error;
+};
+
+bool findVisitor(void* userData, const void* data, size_t size) {
+    FindContext* context = static_cast<FindContext*>(userData);
+    try {
+        context->columns.appendFlatBuffer(data, size);
+        context->count++;
+        return true;
+    } catch (...) {  // Do not let exceptions pass through the C API
+        context->error = std::current_exception();
+        return false;
+    }
+}
+
+}  // namespace
+
+void SensorValuesColumns::reserve(size_t count) {
+    id.reserve(count);
+    time.reserve(count);
+    temperatureOutside.reserve(count);
+    temperatureInside.reserve(count);
+    temperatureCpu.reserve(count);
+    loadCpu1.reserve(count);
+    loadCpu2.reserve(count);
+    loadCpu3.reserve(count);
+    loadCpu4.reserve(count);
+}
+
+void SensorValuesColumns::resize(size_t count) { SensorValuesFields::forEach(ResizeColumn{*this, count}); }
+
+void SensorValuesColumns::clear() { resize(0); }
+
+SensorValuesColumns SensorValuesColumns::fromObjects(const SensorValues* objects, size_t count) {
+    SensorValuesColumns columns;
+    columns.reserve(count);
+    for (size_t i = 0; i < count; ++i) columns.push_back(objects[i]);
+    return columns;
+}
+
+std::vector<SensorValues> SensorValuesColumns::toObjects() const {
+    std::vector<SensorValues> objects;
+    objects.reserve(size());
+    for (size_t i = 0; i < size(); ++i) objects.push_back(row(i));
+    return objects;
+}
+
+SensorValuesColumns SensorValuesColumns::fromFlatBuffers(const OBX_bytes* objects, size_t count) {
+    SensorValuesColumns columns;
+    columns.reserve(count);
+    for (size_t i = 0; i < count; ++i) columns.appendFlatBuffer(objects[i].data, objects[i].size);
+    return columns;
+}
+
+void SensorValuesColumns::appendFlatBuffer(const void* data, size_t size) {
+    SensorValues object;
+    SensorValuesFastDecoder::fromFlatBuffer(data, size, object);
+    push_back(object);
+}
+
+void SensorValuesColumns::toFlatBuffers(SensorValuesBatch& outBatch, unsigned threadCount) const {
+    outBatch.serialize(*this, threadCount);
+}
+
+obx_id objectbox::tsdemo::putColumns(obx::Box<SensorValues>& box, SensorValuesColumns& columns,
+                                     unsigned threadCount) {
+    SensorValuesBatch batch;
+    columns.toFlatBuffers(batch, threadCount);
+    obx_id firstId = putBatch(box, batch);
+    for (size_t i = 0; i < columns.size(); ++i) columns.id[i] = firstId + i;
+    return firstId;
+}
+
+uint64_t objectbox::tsdemo::findColumns(obx::Query<SensorValues>& query, SensorValuesColumns& outColumns) {
+    FindContext context{outColumns, 0, nullptr};
+    obx_err err = obx_query_visit(query.cPtr(), findVisitor, &context);
+    if (context.error) std::rethrow_exception(context.error);
+    if (err != OBX_SUCCESS) throw std::runtime_error(std::string("Query failed: ") + obx_last_error_message());
+    return context.count;
+}
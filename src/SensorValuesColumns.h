@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESCOLUMNS_H
+#define OBJECTBOX_SENSORVALUESCOLUMNS_H
+
+#include <vector>
+
+#include "SensorValuesFields.h"
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+class SensorValuesBatch;
+
+/// SensorValues as struct of arrays: one vector per property (in property order), e.g. for analytics code scanning
+/// a few properties of many objects. Row i consists of the i-th value of each column; all columns have size().
+struct SensorValuesColumns {
+    std::vector<obx_id> id;
+    std::vector<int64_t> time;
+    std::vector<double> temperatureOutside;
+    std::vector<double> temperatureInside;
+    std::vector<double> temperatureCpu;
+    std::vector<double> loadCpu1;
+    std::vector<double> loadCpu2;
+    std::vector<double> loadCpu3;
+    std::vector<double> loadCpu4;
+
+    size_t size() const { return id.size(); }
+
+    bool empty() const { return id.empty(); }
+
+    void reserve(size_t count);
+
+    void resize(size_t count);
+
+    void clear();
+
+    void push_back(const SensorValues& object) {
+        id.push_back(object.id);
+        time.push_back(object.time);
+        temperatureOutside.push_back(object.temperatureOutside);
+        temperatureInside.push_back(object.temperatureInside);
+        temperatureCpu.push_back(object.temperatureCpu);
+        loadCpu1.push_back(object.loadCpu1);
+        loadCpu2.push_back(object.loadCpu2);
+        loadCpu3.push_back(object.loadCpu3);
+        loadCpu4.push_back(object.loadCpu4);
+    }
+
+    SensorValues row(size_t index) const {
+        return SensorValues{id[index], time[index], temperatureOutside[index], temperatureInside[index],
+                            temperatureCpu[index], loadCpu1[index], loadCpu2[index], loadCpu3[index], loadCpu4[index]};
+    }
+
+    /// The column of a field, e.g. column(SensorValuesFields::loadCpu1()), for kernels templated on the field
+    std::vector<obx_id>& column(SensorValuesFields::id) { return id; }
+    std::vector<int64_t>& column(SensorValuesFields::time) { return time; }
+    std::vector<double>& column(SensorValuesFields::temperatureOutside) { return temperatureOutside; }
+    std::vector<double>& column(SensorValuesFields::temperatureInside) { return temperatureInside; }
+    std::vector<double>& column(SensorValuesFields::temperatureCpu) { return temperatureCpu; }
+    std::vector<double>& column(SensorValuesFields::loadCpu1) { return loadCpu1; }
+    std::vector<double>& column(SensorValuesFields::loadCpu2) { return loadCpu2; }
+    std::vector<double>& column(SensorValuesFields::loadCpu3) { return loadCpu3; }
+    std::vector<double>& column(SensorValuesFields::loadCpu4) { return loadCpu4; }
+
+    template <typename Field>
+    const std::vector<typename Field::ValueType>& column(Field field) const {
+        return const_cast<SensorValuesColumns*>(this)->column(field);
+    }
+
+    static SensorValuesColumns fromObjects(const SensorValues* objects, size_t count);
+
+    std::vector<SensorValues> toObjects() const;
+
+    /// Decodes valid SensorValues FlatBuffers (e.g. collected by a query visitor) into columns
+    static SensorValuesColumns fromFlatBuffers(const OBX_bytes* objects, size_t count);
+
+    /// Appends the object of a valid SensorValues FlatBuffer as a new row
+    void appendFlatBuffer(const void* data, size_t size);
+
+    /// Serializes all rows into the given batch, e.g. for putBatch() (see SensorValuesBatch::serialize())
+    void toFlatBuffers(SensorValuesBatch& outBatch, unsigned threadCount = 1) const;
+};
+
+/// Puts all rows as new objects (see putBatch()) and sets the assigned IDs in the id column
+/// @returns the ID of the first object
+obx_id putColumns(obx::Box<SensorValues>& box, SensorValuesColumns& columns, unsigned threadCount = 1);
+
+/// Appends all results of the query to the given columns (within a single read transaction)
+/// @returns the number of appended rows
+uint64_t findColumns(obx::Query<SensorValues>& query, SensorValuesColumns& outColumns);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESCOLUMNS_H
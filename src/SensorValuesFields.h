@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESFIELDS_H
+#define OBJECTBOX_SENSORVALUESFIELDS_H
+
+#include <algorithm>
+#include <limits>
+
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Compile-time descriptor of a SensorValues property, complementing the generated (runtime) SensorValues_.
+/// Member pointer, vtable slot and type are template arguments, so a kernel templated on the field (e.g.
+/// summarize<SensorValuesFields::loadCpu1>()) is instantiated per field with all accesses inlined, i.e. without
+/// switching on the property at runtime. Index is the position in property order (0 is id) like in the .fbs file.
+template <int Index, typename T, T SensorValues::*Member, OBXPropertyType Type>
+struct SensorValuesField {
+    typedef T ValueType;
+
+    static constexpr int index() { return Index; }
+
+    /// Offset in the vtable as used by the generated binding (AddElement()/GetField())
+    static constexpr flatbuffers::voffset_t vtableOffset() {
+        return static_cast<flatbuffers::voffset_t>(sizeof(flatbuffers::voffset_t) * (2 + Index));
+    }
+
+    static constexpr OBXPropertyType type() { return Type; }
+
+    static constexpr obx_schema_id id() { return Index + 1; }
+
+    static constexpr T SensorValues::*member() { return Member; }
+
+    /// The property for building queries, e.g. SensorValuesFields::time::property().between(begin, end)
+    static obx::Property<SensorValues, Type> property() { return obx::Property<SensorValues, Type>(id()); }
+
+    static const T& get(const SensorValues& object) { return object.*Member; }
+
+    static void set(SensorValues& object, T value) { object.*Member = value; }
+
+    /// Reads the field from a valid SensorValues table (or the default value 0 if it is not present)
+    static T read(const flatbuffers::Table* table) { return table->GetField<T>(vtableOffset(), T()); }
+};
+
+/// All SensorValues fields as types, in property order
+struct SensorValuesFields {
+    typedef SensorValuesField<0, obx_id, &SensorValues::id, OBXPropertyType_Long> id;
+    typedef SensorValuesField<1, int64_t, &SensorValues::time, OBXPropertyType_Date> time;
+    typedef SensorValuesField<2, double, &SensorValues::temperatureOutside, OBXPropertyType_Double> temperatureOutside;
+    typedef SensorValuesField<3, double, &SensorValues::temperatureInside, OBXPropertyType_Double> temperatureInside;
+    typedef SensorValuesField<4, double, &SensorValues::temperatureCpu, OBXPropertyType_Double> temperatureCpu;
+    typedef SensorValuesField<5, double, &SensorValues::loadCpu1, OBXPropertyType_Double> loadCpu1;
+    typedef SensorValuesField<6, double, &SensorValues::loadCpu2, OBXPropertyType_Double> loadCpu2;
+    typedef SensorValuesField<7, double, &SensorValues::loadCpu3, OBXPropertyType_Double> loadCpu3;
+    typedef SensorValuesField<8, double, &SensorValues::loadCpu4, OBXPropertyType_Double> loadCpu4;
+
+    static const int kCount = 9;
+
+    /// Calls fn(Field()) for each field in property order; fn needs a call operator template like:
+    ///     struct Print { template <typename Field> void operator()(Field) const { ... } };
+    template <typename Fn>
+    static void forEach(Fn&& fn) {
+        fn(id());
+        fn(time());
+        fn(temperatureOutside());
+        fn(temperatureInside());
+        fn(temperatureCpu());
+        fn(loadCpu1());
+        fn(loadCpu2());
+        fn(loadCpu3());
+        fn(loadCpu4());
+    }
+};
+
+static_assert(SensorValuesFields::loadCpu4::vtableOffset() == 20, "Unexpected vtable offset");
+
+template <typename T>
+struct FieldSummary {
+    T min;
+    T max;
+    double sum;
+    size_t count;
+
+    double mean() const { return count ? sum / count : 0; }
+};
+
+/// Min, max and sum of a field over many SensorValues FlatBuffers (e.g. collected by a query visitor)
+template <typename Field>
+FieldSummary<typename Field::ValueType> summarize(const OBX_bytes* objects, size_t count) {
+    typedef typename Field::ValueType T;
+    FieldSummary<T> summary{std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), 0, count};
+    for (size_t i = 0; i < count; ++i) {
+        T value = Field::read(flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data));
+        summary.min = std::min(summary.min, value);
+        summary.max = std::max(summary.max, value);
+        summary.sum += static_cast<double>(value);
+    }
+    return summary;
+}
+
+/// Min, max and sum of a field over decoded objects
+template <typename Field>
+FieldSummary<typename Field::ValueType> summarize(const SensorValues* objects, size_t count) {
+    typedef typename Field::ValueType T;
+    FieldSummary<T> summary{std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), 0, count};
+    for (size_t i = 0; i < count; ++i) {
+        T value = Field::get(objects[i]);
+        summary.min = std::min(summary.min, value);
+        summary.max = std::max(summary.max, value);
+        summary.sum += static_cast<double>(value);
+    }
+    return summary;
+}
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESFIELDS_H
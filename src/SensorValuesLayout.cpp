@@ -0,0 +1,44 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesLayout.h"
+
+using namespace objectbox::tsdemo;
+
+SensorValuesLayout::SensorValuesLayout() {
+    flatbuffers::WriteScalar<flatbuffers::voffset_t>(vtable_, kVTableSize);
+    flatbuffers::WriteScalar<flatbuffers::voffset_t>(vtable_ + 2, kTableSize);
+    for (int i = 0; i < kFieldCount; ++i) {
+        flatbuffers::WriteScalar<flatbuffers::voffset_t>(vtable_ + 4 + 2 * i, fieldOffset(i));
+    }
+
+    // Check against what the generated binding actually writes
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);
+    SensorValues sample{};
+    SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, sample);
+    const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(fbb.GetBufferPointer());
+    const uint8_t* vtable = table->GetVTable();
+    valid_ = flatbuffers::ReadScalar<flatbuffers::voffset_t>(vtable) == kVTableSize &&
+             memcmp(vtable, vtable_, kVTableSize) == 0;
+    bufferTemplate_.assign(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+    tableOffset_ = static_cast<size_t>(reinterpret_cast<const uint8_t*>(table) - fbb.GetBufferPointer());
+}
+
+const SensorValuesLayout& SensorValuesLayout::get() {
+    static const SensorValuesLayout instance;
+    return instance;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESLAYOUT_H
+#define OBJECTBOX_SENSORVALUESLAYOUT_H
+
+#include <cstring>
+#include <vector>
+
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// The FlatBuffers layout of SensorValues as written by the generated binding with all fields present
+/// (FlatBufferBuilder::ForceDefaults(true), which is also what our bulk writers use).
+/// All such buffers have identical vtables, which allows to access all fields at fixed (compile-time) offsets.
+/// The expected layout is checked once against the output of the generated binding; if it differs (e.g. after a
+/// schema change), matches() always returns false, so users fall back to the generic code path.
+class SensorValuesLayout {
+public:
+    static const int kFieldCount = 9;
+
+    /// vtable size in bytes: vtable and table size followed by one offset per field
+    static const size_t kVTableSize = (2 + kFieldCount) * sizeof(flatbuffers::voffset_t);
+
+    /// Table size in bytes: the vtable offset followed by all fields (8 bytes each)
+    static const size_t kTableSize = sizeof(flatbuffers::soffset_t) + kFieldCount * 8;
+
+    /// Offset of a field (in property order, i.e. 0 is id) relative to the start of the table.
+    /// The builder writes back to front, so the first added field (id) ends up last.
+    static constexpr flatbuffers::voffset_t fieldOffset(int field) {
+        return static_cast<flatbuffers::voffset_t>(sizeof(flatbuffers::soffset_t) + 8 * (kFieldCount - 1 - field));
+    }
+
+private:
+    uint8_t vtable_[kVTableSize];
+    bool valid_;
+    std::vector<uint8_t> bufferTemplate_;
+    size_t tableOffset_;
+
+    SensorValuesLayout();
+
+public:
+    /// The layout instance (initialized on first use)
+    static const SensorValuesLayout& get();
+
+    /// Whether the generated binding writes the expected layout
+    bool valid() const { return valid_; }
+
+    /// The expected vtable bytes (kVTableSize)
+    const uint8_t* vtable() const { return vtable_; }
+
+    /// A complete FlatBuffer with this layout and all values zero, as written by the generated binding.
+    /// Copying it and setting the fields at tableOffset() + fieldOffset() serializes an object.
+    const std::vector<uint8_t>& bufferTemplate() const { return bufferTemplate_; }
+
+    /// Offset of the table within bufferTemplate()
+    size_t tableOffset() const { return tableOffset_; }
+
+    /// Whether the given table has the expected layout (one comparison of the vtable bytes)
+    bool matches(const flatbuffers::Table* table) const {
+        const uint8_t* vtable = table->GetVTable();
+        // Compare the vtable size first, so we never read beyond a shorter vtable; the constant size of the second
+        // comparison allows compilers to inline it
+        return valid_ && flatbuffers::ReadScalar<flatbuffers::voffset_t>(vtable) == kVTableSize &&
+               memcmp(vtable, vtable_, kVTableSize) == 0;
+    }
+};
+
+/// Decodes SensorValues using SensorValuesLayout: if the vtable of a buffer matches the expected layout,
+/// all fields are read at fixed offsets; otherwise it falls back to the generated binding.
+/// The fast path is inline, so it can be inlined into scan loops.
+struct SensorValuesFastDecoder {
+    /// Read an object from a valid FlatBuffer
+    static void fromFlatBuffer(const void* data, size_t size, SensorValues& outObject) {
+        static const SensorValuesLayout& layout = SensorValuesLayout::get();
+        const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+        if (!layout.matches(table)) {
+            SensorValues::_OBX_MetaInfo::fromFlatBuffer(data, size, outObject);
+            return;
+        }
+        typedef SensorValuesLayout L;
+        const uint8_t* fields = reinterpret_cast<const uint8_t*>(table);
+        outObject.id = flatbuffers::ReadScalar<obx_id>(fields + L::fieldOffset(0));
+        outObject.time = flatbuffers::ReadScalar<int64_t>(fields + L::fieldOffset(1));
+        outObject.temperatureOutside = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(2));
+        outObject.temperatureInside = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(3));
+        outObject.temperatureCpu = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(4));
+        outObject.loadCpu1 = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(5));
+        outObject.loadCpu2 = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(6));
+        outObject.loadCpu3 = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(7));
+        outObject.loadCpu4 = flatbuffers::ReadScalar<double>(fields + L::fieldOffset(8));
+    }
+};
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESLAYOUT_H
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesPacking.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+const size_t SensorValuesPacking::kPayloadSize;
+
+SensorValuesPacked SensorValuesPacking::pack(const SensorValues& object) {
+    return SensorValuesPacked{object.id,
+                              object.time,
+                              {object.temperatureOutside, object.temperatureInside, object.temperatureCpu,
+                               object.loadCpu1, object.loadCpu2, object.loadCpu3, object.loadCpu4}};
+}
+
+SensorValues SensorValuesPacking::unpack(const SensorValuesPacked& object) {
+    const std::vector<double>& p = object.payload;
+    auto value = [&p](size_t index) { return index < p.size() ? p[index] : 0.0; };
+    return SensorValues{object.id, object.time, value(0), value(1), value(2), value(3), value(4), value(5), value(6)};
+}
+
+void SensorValuesPacking::toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object) {
+    const double payload[kPayloadSize] = {object.temperatureOutside, object.temperatureInside, object.temperatureCpu,
+                                          object.loadCpu1, object.loadCpu2, object.loadCpu3, object.loadCpu4};
+    // Same layout as the generated binding for SensorValuesPacked
+    fbb.Clear();
+    auto offsetPayload = fbb.CreateVector(payload, kPayloadSize);
+    flatbuffers::uoffset_t fbStart = fbb.StartTable();
+    fbb.AddElement(4, object.id);
+    fbb.AddElement(6, object.time);
+    fbb.AddOffset(8, offsetPayload);
+    flatbuffers::Offset<flatbuffers::Table> offset;
+    offset.o = fbb.EndTable(fbStart);
+    fbb.Finish(offset);
+}
+
+void SensorValuesPacking::readShortPayload(const flatbuffers::Vector<double>* payload, SensorValues& outObject) {
+    double values[kPayloadSize] = {};
+    if (payload) {
+        for (flatbuffers::uoffset_t i = 0; i < payload->size() && i < kPayloadSize; ++i) values[i] = payload->Get(i);
+    }
+    outObject.temperatureOutside = values[0];
+    outObject.temperatureInside = values[1];
+    outObject.temperatureCpu = values[2];
+    outObject.loadCpu1 = values[3];
+    outObject.loadCpu2 = values[4];
+    outObject.loadCpu3 = values[5];
+    outObject.loadCpu4 = values[6];
+}
+
+uint64_t objectbox::tsdemo::migrateToPacked(obx::Store& store, obx::Box<SensorValues>& source,
+                                            obx::Box<SensorValuesPacked>& target, bool removeSource,
+                                            size_t chunkSize) {
+    uint64_t count = 0;
+    obx_id lastId = 0;
+    std::vector<SensorValuesPacked> packed;
+    std::vector<obx_id> ids;
+    while (true) {
+        obx::Transaction tx = store.txWrite();
+        // Page by ID (results are ordered by ID): unlike offset(), this does not skip all previous objects again
+        obx::QueryBuilder<SensorValues> queryBuilder = source.query();
+        queryBuilder.with(SensorValues_::id.greaterThan(static_cast<int64_t>(lastId)));
+        std::vector<SensorValues> chunk = queryBuilder.build().limit(chunkSize).find();
+        if (chunk.empty()) break;
+        packed.clear();
+        ids.clear();
+        for (const SensorValues& object : chunk) {
+            packed.push_back(SensorValuesPacking::pack(object));
+            ids.push_back(object.id);
+        }
+        target.put(packed);  // keeps the IDs: SensorValuesPacked.id is self-assignable
+        if (removeSource) source.remove(ids);
+        tx.success();
+        count += chunk.size();
+        lastId = chunk.back().id;
+        if (chunk.size() < chunkSize) break;
+    }
+    return count;
+}
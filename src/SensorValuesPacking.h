@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESPACKING_H
+#define OBJECTBOX_SENSORVALUESPACKING_H
+
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Storage codec mapping SensorValues to the SensorValuesPacked entity (see ts-data-model.fbs): the seven doubles
+/// are stored as one vector, so reading them takes one vtable lookup instead of seven, plus following the vector's
+/// offset and checking its length. Lossless.
+/// Use it with an obx::Box<SensorValuesPacked> via pack()/unpack() or directly on FlatBuffers.
+struct SensorValuesPacking {
+    /// Number of doubles in the payload: temperatureOutside, temperatureInside, temperatureCpu, loadCpu1..4
+    static const size_t kPayloadSize = 7;
+
+    static SensorValuesPacked pack(const SensorValues& object);
+
+    static SensorValues unpack(const SensorValuesPacked& object);
+
+    /// Write given object to the FlatBufferBuilder using the SensorValuesPacked layout (without a temporary vector)
+    static void toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object);
+
+    /// Read an object from a valid SensorValuesPacked FlatBuffer; values missing in the payload are set to 0.
+    /// Inline, so it can be inlined into scan loops.
+    static void fromFlatBuffer(const void* data, size_t, SensorValues& outObject) {
+        const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+        outObject.id = table->GetField<obx_id>(4, 0);
+        outObject.time = table->GetField<int64_t>(6, 0);
+        const auto* payload = table->GetPointer<const flatbuffers::Vector<double>*>(8);
+        if (payload && payload->size() >= kPayloadSize) {
+            const uint8_t* values = payload->Data();
+            outObject.temperatureOutside = flatbuffers::ReadScalar<double>(values);
+            outObject.temperatureInside = flatbuffers::ReadScalar<double>(values + 8);
+            outObject.temperatureCpu = flatbuffers::ReadScalar<double>(values + 16);
+            outObject.loadCpu1 = flatbuffers::ReadScalar<double>(values + 24);
+            outObject.loadCpu2 = flatbuffers::ReadScalar<double>(values + 32);
+            outObject.loadCpu3 = flatbuffers::ReadScalar<double>(values + 40);
+            outObject.loadCpu4 = flatbuffers::ReadScalar<double>(values + 48);
+        } else {
+            readShortPayload(payload, outObject);
+        }
+    }
+
+private:
+    static void readShortPayload(const flatbuffers::Vector<double>* payload, SensorValues& outObject);
+};
+
+/// Migration path from SensorValues to SensorValuesPacked: copies all SensorValues objects (keeping their IDs, which
+/// requires the self-assignable SensorValuesPacked.id) in chunks of chunkSize objects, each in its own write
+/// transaction (which bounds the transaction size), and optionally removes the originals of each chunk in the same
+/// transaction. Objects already in the target box with the same IDs are overwritten, so an interrupted migration can
+/// simply be run again.
+/// @returns the number of migrated objects
+uint64_t migrateToPacked(obx::Store& store, obx::Box<SensorValues>& source, obx::Box<SensorValuesPacked>& target,
+                         bool removeSource, size_t chunkSize = 100000);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESPACKING_H
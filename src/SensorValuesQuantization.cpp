@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesQuantization.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+constexpr LinearQuantizer<int16_t> SensorValuesQuantization::temperatureOutside;
+constexpr Float32Quantizer SensorValuesQuantization::loadCpu;
+
+SensorValuesQuantized SensorValuesQuantization::quantize(const SensorValues& object) {
+    return SensorValuesQuantized{object.id,
+                                 object.time,
+                                 temperatureOutside.encode(object.temperatureOutside),
+                                 object.temperatureInside,
+                                 object.temperatureCpu,
+                                 loadCpu.encode(object.loadCpu1),
+                                 loadCpu.encode(object.loadCpu2),
+                                 loadCpu.encode(object.loadCpu3),
+                                 loadCpu.encode(object.loadCpu4)};
+}
+
+SensorValues SensorValuesQuantization::dequantize(const SensorValuesQuantized& object) {
+    return SensorValues{object.id,
+                        object.time,
+                        temperatureOutside.decode(object.temperatureOutside),
+                        object.temperatureInside,
+                        object.temperatureCpu,
+                        loadCpu.decode(object.loadCpu1),
+                        loadCpu.decode(object.loadCpu2),
+                        loadCpu.decode(object.loadCpu3),
+                        loadCpu.decode(object.loadCpu4)};
+}
+
+void SensorValuesQuantization::toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object) {
+    // The quantized object only lives on the stack; the generated binding defines the FlatBuffers layout
+    SensorValuesQuantized::_OBX_MetaInfo::toFlatBuffer(fbb, quantize(object));
+}
+
+void SensorValuesQuantization::fromFlatBuffer(const void* data, size_t size, SensorValues& outObject) {
+    SensorValuesQuantized quantized;
+    SensorValuesQuantized::_OBX_MetaInfo::fromFlatBuffer(data, size, quantized);
+    outObject = dequantize(quantized);
+}
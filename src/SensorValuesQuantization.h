@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESQUANTIZATION_H
+#define OBJECTBOX_SENSORVALUESQUANTIZATION_H
+
+#include "ts-data-model.obx.hpp"
+#include "util/Quantizer.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Lossy storage codec mapping SensorValues to the SensorValuesQuantized entity (see ts-data-model.fbs).
+/// The stored property types in the .fbs file select the quantization mode; scale and offset are defined here
+/// (the comments in the .fbs file only document them, so keep those in sync when changing a constant).
+/// Properties not listed here are stored unchanged (no loss).
+/// Use it with an obx::Box<SensorValuesQuantized> via quantize()/dequantize() or directly on FlatBuffers.
+struct SensorValuesQuantization {
+    /// int16 in steps of 1/128: range [-256, 256), max. absolute error 1/256 (~0.004 degrees)
+    static constexpr LinearQuantizer<int16_t> temperatureOutside{1.0 / 128};
+
+    /// float32 (for loadCpu1..4): max. relative error 2^-24 (~6e-8)
+    static constexpr Float32Quantizer loadCpu{};
+
+    static SensorValuesQuantized quantize(const SensorValues& object);
+
+    static SensorValues dequantize(const SensorValuesQuantized& object);
+
+    /// Write given object to the FlatBufferBuilder using the SensorValuesQuantized layout
+    static void toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object);
+
+    /// Read an object from a valid SensorValuesQuantized FlatBuffer
+    static void fromFlatBuffer(const void* data, size_t size, SensorValues& outObject);
+};
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESQUANTIZATION_H
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValuesVerifier.h"
+
+using namespace objectbox::tsdemo;
+
+namespace {
+
+typedef SensorValuesLayout L;
+
+/// Table accessor with a Verify() method like flatc generates it, so it can be used with flatbuffers::Verifier
+struct SensorValuesTable : private flatbuffers::Table {
+    bool Verify(flatbuffers::Verifier& verifier) const {
+        return VerifyTableStart(verifier) && VerifyField<obx_id>(verifier, 4, 8) &&
+               VerifyField<int64_t>(verifier, 6, 8) && VerifyField<double>(verifier, 8, 8) &&
+               VerifyField<double>(verifier, 10, 8) && VerifyField<double>(verifier, 12, 8) &&
+               VerifyField<double>(verifier, 14, 8) && VerifyField<double>(verifier, 16, 8) &&
+               VerifyField<double>(verifier, 18, 8) && VerifyField<double>(verifier, 20, 8) && verifier.EndTable();
+    }
+};
+
+}  // namespace
+
+bool SensorValuesVerifier::verify(const void* data, size_t size) {
+    static const SensorValuesLayout& layout = SensorValuesLayout::get();
+    const uint8_t* buffer = static_cast<const uint8_t*>(data);
+    if (layout.valid() && size >= L::kTableSize && size < FLATBUFFERS_MAX_BUFFER_SIZE) {
+        size_t tableOffset = flatbuffers::ReadScalar<flatbuffers::uoffset_t>(buffer);
+        // The vtable stores the table size and all field offsets, so if it matches, all fields are within the table;
+        // 8 byte alignment of the fields is also required (like flatbuffers::Verifier does)
+        if (tableOffset <= size - L::kTableSize && (tableOffset + L::fieldOffset(0)) % 8 == 0) {
+            int64_t vtableOffset = static_cast<int64_t>(tableOffset) -
+                                   flatbuffers::ReadScalar<flatbuffers::soffset_t>(buffer + tableOffset);
+            if (vtableOffset >= 0 && vtableOffset % 2 == 0 &&
+                static_cast<uint64_t>(vtableOffset) <= size - L::kVTableSize &&
+                memcmp(buffer + vtableOffset, layout.vtable(), L::kVTableSize) == 0) {
+                return true;
+            }
+        }
+    }
+    return verifyGeneric(data, size);
+}
+
+bool SensorValuesVerifier::verifyGeneric(const void* data, size_t size) {
+    flatbuffers::Verifier verifier(static_cast<const uint8_t*>(data), size);
+    return verifier.VerifyBuffer<SensorValuesTable>(nullptr);
+}
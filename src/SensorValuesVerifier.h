@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_SENSORVALUESVERIFIER_H
+#define OBJECTBOX_SENSORVALUESVERIFIER_H
+
+#include "SensorValuesLayout.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Whether object data comes from a trusted source, i.e. was written by this process or read from our own database.
+/// Only untrusted data (e.g. from imports) needs to be verified before reading it.
+enum class DataTrust { Trusted, Untrusted };
+
+/// Checks that SensorValues data is a well-formed FlatBuffer, so reading its fields stays within the buffer.
+struct SensorValuesVerifier {
+    /// Fixed-schema fast path for buffers with SensorValuesLayout: a single bounds check of the table against the
+    /// known table size and a comparison of the vtable bytes; falls back to verifyGeneric() for other layouts.
+    static bool verify(const void* data, size_t size);
+
+    /// Full check with flatbuffers::Verifier (walks the table and checks each field)
+    static bool verifyGeneric(const void* data, size_t size);
+};
+
+/// Verifies untrusted data (trusted data is not checked at all) and decodes it with SensorValuesFastDecoder
+/// @returns false if the data failed verification (outObject is unchanged then)
+inline bool readSensorValues(const void* data, size_t size, SensorValues& outObject, DataTrust trust) {
+    if (trust == DataTrust::Untrusted && !SensorValuesVerifier::verify(data, size)) return false;
+    SensorValuesFastDecoder::fromFlatBuffer(data, size, outObject);
+    return true;
+}
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_SENSORVALUESVERIFIER_H
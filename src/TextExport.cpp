@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TextExport.h"
+
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+
+#include "SensorValuesLayout.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+bool endsWith(const std::string& text, const char* suffix) {
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+struct ExportContext {
+    SensorValuesTextWriter& writer;
+    uint64_t count;
+    std::exception_ptr error;
+};
+
+bool exportVisitor(void* userData, const void* data, size_t size) {
+    ExportContext* context = static_cast<ExportContext*>(userData);
+    try {
+        SensorValues object;
+        SensorValuesFastDecoder::fromFlatBuffer(data, size, object);
+        context->writer.write(object);
+        context->count++;
+        return true;
+    } catch (...) {  // Do not let exceptions pass through the C API
+        context->error = std::current_exception();
+        return false;
+    }
+}
+
+}  // namespace
+
+bool objectbox::tsdemo::textFormatForPath(const std::string& path, TextFormat& outFormat) {
+    if (endsWith(path, ".jsonl") || endsWith(path, ".ndjson")) {
+        outFormat = TextFormat::JsonLines;
+    } else if (endsWith(path, ".json")) {
+        outFormat = TextFormat::JsonArray;
+    } else if (endsWith(path, ".csv")) {
+        outFormat = TextFormat::Csv;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+SensorValuesTextWriter::SensorValuesTextWriter(BufferedTextWriter& out, TextFormat format)
+    : out_(out), format_(format) {
+    if (format_ == TextFormat::Csv) {
+        out_.write("id,time,temperatureOutside,temperatureInside,temperatureCpu,loadCpu1,loadCpu2,loadCpu3,loadCpu4\n");
+    } else if (format_ == TextFormat::JsonArray) {
+        out_.write('[');
+    }
+}
+
+void SensorValuesTextWriter::finish() {
+    if (format_ == TextFormat::JsonArray) out_.write(first_ ? "]\n" : "\n]\n");
+}
+
+void SensorValuesTextWriter::writeDouble(double value) {
+    if (std::isfinite(value)) {
+        out_.writeDouble(value);
+    } else if (format_ != TextFormat::Csv) {
+        out_.write("null");
+    }
+}
+
+void SensorValuesTextWriter::write(const SensorValues& object) {
+    if (format_ != TextFormat::Csv) {
+        if (format_ == TextFormat::JsonArray) out_.write(first_ ? "\n" : ",\n");
+        first_ = false;
+        out_.write("{\"id\":");
+        out_.writeInt(static_cast<int64_t>(object.id));
+        out_.write(",\"time\":\"");
+        out_.writeTimestamp(object.time);
+        out_.write("\",\"temperatureOutside\":");
+        writeDouble(object.temperatureOutside);
+        out_.write(",\"temperatureInside\":");
+        writeDouble(object.temperatureInside);
+        out_.write(",\"temperatureCpu\":");
+        writeDouble(object.temperatureCpu);
+        out_.write(",\"loadCpu1\":");
+        writeDouble(object.loadCpu1);
+        out_.write(",\"loadCpu2\":");
+        writeDouble(object.loadCpu2);
+        out_.write(",\"loadCpu3\":");
+        writeDouble(object.loadCpu3);
+        out_.write(",\"loadCpu4\":");
+        writeDouble(object.loadCpu4);
+        out_.write('}');
+        if (format_ == TextFormat::JsonLines) out_.write('\n');
+    } else {
+        out_.writeInt(static_cast<int64_t>(object.id));
+        out_.write(',');
+        out_.writeTimestamp(object.time);
+        out_.write(',');
+        writeDouble(object.temperatureOutside);
+        out_.write(',');
+        writeDouble(object.temperatureInside);
+        out_.write(',');
+        writeDouble(object.temperatureCpu);
+        out_.write(',');
+        writeDouble(object.loadCpu1);
+        out_.write(',');
+        writeDouble(object.loadCpu2);
+        out_.write(',');
+        writeDouble(object.loadCpu3);
+        out_.write(',');
+        writeDouble(object.loadCpu4);
+        out_.write('\n');
+    }
+}
+
+uint64_t objectbox::tsdemo::exportSensorValuesText(obx::Box<SensorValues>& box, const std::string& path,
+                                                   TextFormat format, int64_t timeBegin, int64_t timeEnd,
+                                                   uint64_t* outBytes) {
+    obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+    queryBuilder.with(SensorValues_::time.between(timeBegin, timeEnd));
+    obx::Query<SensorValues> query = queryBuilder.build();
+
+    BufferedTextWriter out(path);
+    SensorValuesTextWriter writer(out, format);
+    ExportContext context{writer, 0, nullptr};
+    obx_err err = obx_query_visit(query.cPtr(), exportVisitor, &context);
+    if (context.error) std::rethrow_exception(context.error);
+    if (err != OBX_SUCCESS) throw std::runtime_error(std::string("Query failed: ") + obx_last_error_message());
+    writer.finish();
+    out.close();
+    if (outBytes) *outBytes = out.bytesWritten();
+    return context.count;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_TEXTEXPORT_H
+#define OBJECTBOX_TEXTEXPORT_H
+
+#include <string>
+
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+#include "util/TextWriter.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+enum class TextFormat {
+    JsonLines,  ///< one JSON object per line
+    JsonArray,  ///< a JSON document: an array with one object per line
+    Csv         ///< header line with the property names, then one line per object
+};
+
+/// Detects the text format from the file extension: ".jsonl"/".ndjson" (JSON lines), ".json" or ".csv"
+/// @returns false if the path does not have a text format extension
+bool textFormatForPath(const std::string& path, TextFormat& outFormat);
+
+/// Writes SensorValues as text: time as ISO 8601 timestamp, doubles in their shortest round-trip representation.
+/// Non-finite doubles are written as null (JSON) or as empty values (CSV).
+class SensorValuesTextWriter {
+    BufferedTextWriter& out_;
+    TextFormat format_;
+    bool first_ = true;
+
+    void writeDouble(double value);
+
+public:
+    /// For CSV, writes the header line; for a JSON array, the opening bracket
+    SensorValuesTextWriter(BufferedTextWriter& out, TextFormat format);
+
+    void write(const SensorValues& object);
+
+    /// Completes the document after the last object (for a JSON array, writes the closing bracket)
+    void finish();
+};
+
+/// Exports all SensorValues within the given time range (inclusive) to a text file.
+/// Objects are streamed from the database into a buffered writer.
+/// @param outBytes optional; receives the size of the written file
+/// @returns the number of exported objects
+uint64_t exportSensorValuesText(obx::Box<SensorValues>& box, const std::string& path, TextFormat format,
+                                int64_t timeBegin, int64_t timeEnd, uint64_t* outBytes = nullptr);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_TEXTEXPORT_H
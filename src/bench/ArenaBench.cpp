@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "util/ArenaAllocator.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// The default allocator (new[]/delete[]) counting its allocations
+class CountingAllocator : public flatbuffers::DefaultAllocator {
+public:
+    uint64_t count = 0;
+
+    uint8_t* allocate(size_t size) override {
+        count++;
+        return flatbuffers::DefaultAllocator::allocate(size);
+    }
+};
+
+/// A new builder for each object, e.g. in code that serializes objects independently
+uint64_t builderPerObject(const std::vector<SensorValues>& values, flatbuffers::Allocator* allocator) {
+    StopWatch stopWatch;
+    uint64_t bytes = 0;
+    for (const SensorValues& object : values) {
+        flatbuffers::FlatBufferBuilder fbb(256, allocator);
+        fbb.ForceDefaults(true);
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        bytes += fbb.GetSize();
+    }
+    uint64_t nanos = stopWatch.durationInNanos();
+    if (bytes == 0) std::cout << "Nothing serialized" << std::endl;
+    return nanos;
+}
+
+/// A builder per batch of 1000 tables written into one buffer, which grows (reallocates) along the way
+uint64_t builderPerBatch(const std::vector<SensorValues>& values, flatbuffers::Allocator* allocator) {
+    StopWatch stopWatch;
+    for (size_t start = 0; start < values.size(); start += 1000) {
+        flatbuffers::FlatBufferBuilder fbb(1024, allocator);
+        fbb.ForceDefaults(true);
+        size_t end = std::min(values.size(), start + 1000);
+        for (size_t i = start; i < end; ++i) {
+            const SensorValues& object = values[i];
+            flatbuffers::uoffset_t fbStart = fbb.StartTable();
+            fbb.AddElement(4, object.id);
+            fbb.AddElement(6, object.time);
+            fbb.AddElement(8, object.temperatureOutside);
+            fbb.AddElement(10, object.temperatureInside);
+            fbb.AddElement(12, object.temperatureCpu);
+            fbb.AddElement(14, object.loadCpu1);
+            fbb.AddElement(16, object.loadCpu2);
+            fbb.AddElement(18, object.loadCpu3);
+            fbb.AddElement(20, object.loadCpu4);
+            fbb.EndTable(fbStart);
+        }
+    }
+    return stopWatch.durationInNanos();
+}
+
+void report(const char* name, int count, uint64_t nanos, uint64_t allocations, size_t osAllocations) {
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << " (" << static_cast<double>(nanos) / count
+              << " ns/object), " << allocations << " allocations, " << osAllocations << " from the OS/heap"
+              << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchArena(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    ArenaAllocator arenaAllocator;
+    Arena& arena = Arena::forThread();
+
+    for (int scenario = 0; scenario < 2; ++scenario) {
+        auto run = scenario == 0 ? builderPerObject : builderPerBatch;
+        std::cout << (scenario == 0 ? "Builder per object" : "Builder per batch of 1000 objects") << std::endl;
+
+        CountingAllocator countingAllocator;
+        uint64_t nanos = run(values, &countingAllocator);
+        report("  Default allocator", count, nanos, countingAllocator.count, countingAllocator.count);
+
+        uint64_t allocationsBefore = arena.allocationCount();
+        size_t chunksBefore = arena.chunkCount();
+        nanos = run(values, &arenaAllocator);
+        report("  Arena allocator", count, nanos, arena.allocationCount() - allocationsBefore,
+               arena.chunkCount() - chunksBefore);
+    }
+}
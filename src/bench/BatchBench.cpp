@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesBatch.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+void printThroughput(const char* name, uint64_t nanos, size_t bytes, size_t count) {
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / count << " ns/object, "
+              << static_cast<double>(bytes) / nanos << " GB/s" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchBatchSerialize(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    for (size_t i = 0; i < values.size(); ++i) values[i].id = i + 1;  // like objects with assigned IDs
+
+    // Baseline: one builder, each object serialized and copied to a contiguous set
+    FlatBufferSet reference;
+    uint64_t nanos = UINT64_MAX;
+    for (int pass = 0; pass < 5; ++pass) {
+        reference = FlatBufferSet();
+        reference.reserve(values.size(), 104);
+        StopWatch stopWatch;
+        flatbuffers::FlatBufferBuilder fbb;
+        fbb.ForceDefaults(true);
+        for (const SensorValues& object : values) {
+            SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+            reference.add(fbb);
+        }
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    printThroughput("FlatBufferBuilder per object", nanos, reference.totalSize(), values.size());
+
+    SensorValuesBatch batch;
+    batch.serialize(values);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < batch.count(); ++i) {
+        const OBX_bytes& object = batch.object(i);
+        if (object.size != reference.size(i) || memcmp(object.data, reference.data(i), object.size) != 0) {
+            mismatches++;
+        }
+    }
+    std::cout << "Batch mismatches (vs. generated code): " << mismatches << std::endl;
+
+    // Powers of two up to all hardware threads
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+    for (unsigned threads : threadCounts) {
+        nanos = UINT64_MAX;
+        for (int pass = 0; pass < 5; ++pass) {
+            StopWatch stopWatch;
+            batch.serialize(values, threads);
+            nanos = std::min(nanos, stopWatch.durationInNanos());
+        }
+        std::string name = "Batch, " + std::to_string(threads) + " thread(s)";
+        printThroughput(name.c_str(), nanos, batch.sizeInBytes(), batch.count());
+    }
+}
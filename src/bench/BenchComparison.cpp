@@ -0,0 +1,313 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BenchComparison.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Continued fraction of the incomplete beta function (modified Lentz's method)
+double betaContinuedFraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double c = 1;
+    double d = 1 - (a + b) * x / (a + 1);
+    d = 1 / (std::fabs(d) < tiny ? tiny : d);
+    double result = d;
+    for (int m = 1; m <= 300; ++m) {
+        for (int step = 0; step < 2; ++step) {
+            double numerator = step == 0 ? m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m))
+                                         : -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+            d = 1 + numerator * d;
+            d = 1 / (std::fabs(d) < tiny ? tiny : d);
+            c = 1 + numerator / c;
+            if (std::fabs(c) < tiny) c = tiny;
+            result *= c * d;
+            if (step == 1 && std::fabs(c * d - 1) < 1e-12) return result;
+        }
+    }
+    return result;
+}
+
+/// Regularized incomplete beta function I_x(a, b)
+double incompleteBeta(double a, double b, double x) {
+    if (x <= 0) return 0;
+    if (x >= 1) return 1;
+    double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) +
+                            b * std::log(1 - x));
+    if (x < (a + 1) / (a + b + 2)) return front * betaContinuedFraction(a, b, x) / a;
+    return 1 - front * betaContinuedFraction(b, a, 1 - x) / b;
+}
+
+/// Probability of |T| >= t for Student's t distribution with the given degrees of freedom
+double studentTTwoSided(double t, double degreesOfFreedom) {
+    return incompleteBeta(degreesOfFreedom / 2, 0.5, degreesOfFreedom / (degreesOfFreedom + t * t));
+}
+
+/// t such that |T| < t with the given probability (e.g. 0.95 -> 12.71 for 1 degree of freedom, 1.96 for many)
+double studentTCritical(double confidence, double degreesOfFreedom) {
+    double alpha = 1 - confidence;
+    double low = 0, high = 1e6;
+    for (int i = 0; i < 100 && high - low > 1e-9 * high; ++i) {  // bisection: the tail probability decreases with t
+        double middle = (low + high) / 2;
+        if (studentTTwoSided(middle, degreesOfFreedom) > alpha) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return (low + high) / 2;
+}
+
+/// Standard error and (Welch-Satterthwaite) degrees of freedom of the difference of two means
+void welchDifference(const SampleStats& a, const SampleStats& b, double& standardError, double& degreesOfFreedom) {
+    double varianceA = a.stddev * a.stddev / a.count;
+    double varianceB = b.stddev * b.stddev / b.count;
+    standardError = std::sqrt(varianceA + varianceB);
+    double denominator = varianceA * varianceA / (a.count - 1) + varianceB * varianceB / (b.count - 1);
+    degreesOfFreedom = denominator > 0 ? (varianceA + varianceB) * (varianceA + varianceB) / denominator : 1;
+}
+
+double changePercent(double baseline, double current) {
+    return baseline > 0 ? (current - baseline) / baseline * 100 : 0;
+}
+
+/// Compact number with 3 significant digits, e.g. 987, 1.23k, 45.6M
+std::string compact(double value) {
+    const char* suffix = "";
+    if (value >= 1e9) {
+        value /= 1e9;
+        suffix = "G";
+    } else if (value >= 1e6) {
+        value /= 1e6;
+        suffix = "M";
+    } else if (value >= 1e3) {
+        value /= 1e3;
+        suffix = "k";
+    }
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), value >= 100 ? "%.0f%s" : value >= 10 ? "%.1f%s" : "%.2f%s", value, suffix);
+    return buffer;
+}
+
+/// Mean throughput with the confidence interval's half width relative to it, e.g. "1.23M (2.1%)"
+std::string statsForLog(const SampleStats& stats) {
+    if (stats.count == 0) return "-";
+    std::string text = compact(stats.mean);
+    if (stats.count < 2 || stats.mean <= 0) return text;
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), " (%.1f%%)", stats.halfWidth / stats.mean * 100);
+    return text + buffer;
+}
+
+const char* verdictName(ResultComparison::Verdict verdict) {
+    switch (verdict) {
+        case ResultComparison::Verdict::Unchanged:
+            return "ok";
+        case ResultComparison::Verdict::NotSignificant:
+            return "noise";
+        case ResultComparison::Verdict::Improvement:
+            return "improvement";
+        case ResultComparison::Verdict::Regression:
+            return "REGRESSION";
+        case ResultComparison::Verdict::Missing:
+            return "missing";
+        case ResultComparison::Verdict::Added:
+            return "new";
+    }
+    return "?";
+}
+
+const JsonValue& resultsOf(const JsonValue& report, const char* which) {
+    const JsonValue& results = report["results"];
+    if (!results.isArray()) throw std::runtime_error(std::string("No results array in the ") + which + " report");
+    return results;
+}
+
+const JsonValue* findResult(const JsonValue& results, const std::string& name) {
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results.at(i)["name"].asString() == name) return &results.at(i);
+    }
+    return nullptr;
+}
+
+void compareResults(const JsonValue& baseline, const JsonValue& current, const ComparisonOptions& options,
+                    ResultComparison& comparison) {
+    comparison.baseline = SampleStats::of(baseline["throughputs"].asNumbers(), options.confidence);
+    comparison.current = SampleStats::of(current["throughputs"].asNumbers(), options.confidence);
+    comparison.changePercent = changePercent(comparison.baseline.mean, comparison.current.mean);
+
+    comparison.tested = comparison.baseline.count >= 2 && comparison.current.count >= 2;
+    bool significant = true;  // without repeated runs, only the threshold can be applied
+    if (comparison.tested) {
+        comparison.pValue = welchTTest(comparison.baseline, comparison.current);
+        significant = comparison.pValue < 1 - options.confidence;
+
+        // Confidence interval of the difference of means, relative to the baseline mean (taken as exact)
+        double standardError, degreesOfFreedom;
+        welchDifference(comparison.baseline, comparison.current, standardError, degreesOfFreedom);
+        double halfWidth = studentTCritical(options.confidence, degreesOfFreedom) * standardError;
+        double mean = comparison.baseline.mean;
+        comparison.changeLowPercent = changePercent(mean, comparison.current.mean - halfWidth);
+        comparison.changeHighPercent = changePercent(mean, comparison.current.mean + halfWidth);
+    }
+
+    if (std::fabs(comparison.changePercent) <= options.thresholdPercent) {
+        comparison.verdict = ResultComparison::Verdict::Unchanged;
+    } else if (!significant) {
+        comparison.verdict = ResultComparison::Verdict::NotSignificant;
+    } else {
+        comparison.verdict = comparison.changePercent < 0 ? ResultComparison::Verdict::Regression
+                                                          : ResultComparison::Verdict::Improvement;
+    }
+
+    const JsonValue& latencyA = baseline["latency"];
+    const JsonValue& latencyB = current["latency"];
+    comparison.p50ChangePercent = changePercent(latencyA["p50"].asNumber(), latencyB["p50"].asNumber());
+    comparison.p99ChangePercent = changePercent(latencyA["p99"].asNumber(), latencyB["p99"].asNumber());
+    comparison.latencyRegression =
+        options.latencyThresholdPercent > 0 && comparison.p99ChangePercent > options.latencyThresholdPercent;
+}
+
+}  // namespace
+
+SampleStats SampleStats::of(const std::vector<double>& samples, double confidence) {
+    SampleStats stats;
+    stats.count = samples.size();
+    if (samples.empty()) return stats;
+    double sum = 0;
+    for (double sample : samples) sum += sample;
+    stats.mean = sum / samples.size();
+    if (samples.size() < 2) return stats;
+    double squares = 0;
+    for (double sample : samples) squares += (sample - stats.mean) * (sample - stats.mean);
+    stats.stddev = std::sqrt(squares / (samples.size() - 1));
+    stats.halfWidth = studentTCritical(confidence, samples.size() - 1) * stats.stddev / std::sqrt(samples.size());
+    return stats;
+}
+
+double objectbox::tsdemo::welchTTest(const SampleStats& a, const SampleStats& b) {
+    if (a.count < 2 || b.count < 2) return 1;
+    double standardError, degreesOfFreedom;
+    welchDifference(a, b, standardError, degreesOfFreedom);
+    if (standardError == 0) return a.mean == b.mean ? 1 : 0;  // no noise at all
+    return studentTTwoSided((b.mean - a.mean) / standardError, degreesOfFreedom);
+}
+
+std::vector<ResultComparison> objectbox::tsdemo::compareReports(const JsonValue& baseline, const JsonValue& current,
+                                                                const ComparisonOptions& options) {
+    const JsonValue& baselineResults = resultsOf(baseline, "baseline");
+    const JsonValue& currentResults = resultsOf(current, "current");
+    std::vector<ResultComparison> comparisons;
+    for (size_t i = 0; i < baselineResults.size(); ++i) {
+        const JsonValue& result = baselineResults.at(i);
+        ResultComparison comparison;
+        comparison.name = result["name"].asString();
+        comparison.unit = result["unit"].asString();
+        const JsonValue* currentResult = findResult(currentResults, comparison.name);
+        if (currentResult) {
+            compareResults(result, *currentResult, options, comparison);
+        } else {
+            comparison.baseline = SampleStats::of(result["throughputs"].asNumbers(), options.confidence);
+            comparison.verdict = ResultComparison::Verdict::Missing;
+        }
+        comparisons.push_back(std::move(comparison));
+    }
+    for (size_t i = 0; i < currentResults.size(); ++i) {
+        const JsonValue& result = currentResults.at(i);
+        if (findResult(baselineResults, result["name"].asString())) continue;
+        ResultComparison comparison;
+        comparison.name = result["name"].asString();
+        comparison.unit = result["unit"].asString();
+        comparison.current = SampleStats::of(result["throughputs"].asNumbers(), options.confidence);
+        comparison.verdict = ResultComparison::Verdict::Added;
+        comparisons.push_back(std::move(comparison));
+    }
+    return comparisons;
+}
+
+size_t objectbox::tsdemo::compareReportFiles(const std::string& baselinePath, const std::string& currentPath,
+                                             const ComparisonOptions& options) {
+    JsonValue baseline = JsonValue::parseFile(baselinePath);
+    JsonValue current = JsonValue::parseFile(currentPath);
+    std::vector<ResultComparison> comparisons = compareReports(baseline, current, options);
+
+    std::cout << "Baseline: " << baselinePath << " (ObjectBox " << baseline["objectboxVersion"].asString() << ")\n"
+              << "Current:  " << currentPath << " (ObjectBox " << current["objectboxVersion"].asString() << ")\n"
+              << "Throughput: mean (" << options.confidence * 100 << "% confidence interval, +/-)\n"
+              << "Regressions: throughput drops beyond " << options.thresholdPercent
+              << "% that are significant (Welch's t-test)";
+    if (options.latencyThresholdPercent > 0) {
+        std::cout << " and p99 latency increases beyond " << options.latencyThresholdPercent << "%";
+    }
+    std::cout << "\n" << std::endl;
+
+    int nameWidth = 4;
+    for (const ResultComparison& comparison : comparisons) {
+        nameWidth = std::max(nameWidth, static_cast<int>(comparison.name.size()));
+    }
+    char line[512];
+    snprintf(line, sizeof(line), "%-*s  %-9s  %14s  %14s  %8s  %-18s  %8s  %8s  %8s  %s", nameWidth, "name", "unit",
+             "baseline", "current", "change", "change CI", "p-value", "p50", "p99", "verdict");
+    std::cout << line << std::endl;
+
+    size_t regressions = 0;
+    bool untested = false;
+    for (const ResultComparison& comparison : comparisons) {
+        bool compared = comparison.verdict != ResultComparison::Verdict::Missing &&
+                        comparison.verdict != ResultComparison::Verdict::Added;
+        char change[16] = "", interval[32] = "", pValue[16] = "", p50[16] = "", p99[16] = "";
+        if (compared) {
+            snprintf(change, sizeof(change), "%+.1f%%", comparison.changePercent);
+            snprintf(p50, sizeof(p50), "%+.1f%%", comparison.p50ChangePercent);
+            snprintf(p99, sizeof(p99), "%+.1f%%", comparison.p99ChangePercent);
+            if (comparison.tested) {
+                snprintf(interval, sizeof(interval), "[%+.1f%%, %+.1f%%]", comparison.changeLowPercent,
+                         comparison.changeHighPercent);
+                snprintf(pValue, sizeof(pValue), "%.4f", comparison.pValue);
+            } else {
+                untested = true;
+                snprintf(pValue, sizeof(pValue), "n/a");
+            }
+        }
+        std::string verdict = verdictName(comparison.verdict);
+        if (comparison.latencyRegression) {
+            verdict += comparison.verdict == ResultComparison::Verdict::Regression ? ", P99 REGRESSION"
+                                                                                    : " (P99 REGRESSION)";
+        }
+        snprintf(line, sizeof(line), "%-*s  %-9s  %14s  %14s  %8s  %-18s  %8s  %8s  %8s  %s", nameWidth,
+                 comparison.name.c_str(), comparison.unit.c_str(), statsForLog(comparison.baseline).c_str(),
+                 statsForLog(comparison.current).c_str(), change, interval, pValue, p50, p99, verdict.c_str());
+        std::cout << line << std::endl;
+        if (comparison.isRegression()) regressions++;
+    }
+
+    if (untested) {
+        std::cout << "\nNote: some results have less than 2 runs in a report, so only the threshold was applied to "
+                     "them (run with --repeats 5 or more for a significance test)."
+                  << std::endl;
+    }
+    std::cout << "\n" << regressions << " regression(s) in " << comparisons.size() << " results" << std::endl;
+    return regressions;
+}
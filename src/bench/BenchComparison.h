@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef OBJECTBOX_BENCHCOMPARISON_H
+#define OBJECTBOX_BENCHCOMPARISON_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "util/JsonReader.h"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Mean and confidence interval of a metric's samples, e.g. the throughputs of all timed runs of a result
+struct SampleStats {
+    size_t count = 0;
+    double mean = 0;
+    double stddev = 0;     // sample standard deviation (n - 1); 0 for less than 2 samples
+    double halfWidth = 0;  // of the confidence interval of the mean (Student's t); 0 for less than 2 samples
+
+    static SampleStats of(const std::vector<double>& samples, double confidence);
+};
+
+struct ComparisonOptions {
+    double thresholdPercent = 5;         // throughput drops beyond this are regressions (if significant)
+    double confidence = 0.95;            // of the confidence intervals and the Welch t-test
+    double latencyThresholdPercent = 0;  // p99 latency increases beyond this are regressions; 0: not checked
+};
+
+/// Comparison of one benchmark result (matched by name) between a baseline and a current report
+struct ResultComparison {
+    enum class Verdict {
+        Unchanged,       // change within the threshold
+        NotSignificant,  // change beyond the threshold, but within the noise of the runs
+        Improvement,
+        Regression,
+        Missing,  // only in the baseline
+        Added     // only in the current report
+    };
+
+    std::string name;
+    std::string unit;
+    SampleStats baseline;  // throughputs
+    SampleStats current;
+    double changePercent = 0;     // of the mean throughput
+    double changeLowPercent = 0;  // confidence interval of the change
+    double changeHighPercent = 0;
+    double pValue = 1;            // Welch's t-test (two-sided); 1 if a report has less than 2 runs
+    bool tested = false;          // false if a report has less than 2 runs, i.e. only the threshold applies
+    double p50ChangePercent = 0;  // latency
+    double p99ChangePercent = 0;
+    bool latencyRegression = false;
+    Verdict verdict = Verdict::Unchanged;
+
+    bool isRegression() const { return verdict == Verdict::Regression || latencyRegression; }
+};
+
+/// Two-sided p-value of Welch's t-test for different means; 1 if a sample has less than 2 values
+double welchTTest(const SampleStats& a, const SampleStats& b);
+
+/// Compares the results of two objectbox_ts_bench reports (JSON as written by workloadReportJson()).
+/// Throws std::runtime_error if a report has no results array.
+std::vector<ResultComparison> compareReports(const JsonValue& baseline, const JsonValue& current,
+                                             const ComparisonOptions& options);
+
+/// Compares two report files and prints a table of all results to stdout.
+/// Throws std::runtime_error if a file cannot be read or parsed.
+/// @returns the number of regressions
+size_t compareReportFiles(const std::string& baselinePath, const std::string& currentPath,
+                          const ComparisonOptions& options);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_BENCHCOMPARISON_H
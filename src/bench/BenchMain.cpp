@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#define OBX_CPP_FILE  // This makes objectbox.hpp emit the definitions (C++ API implementation; needed once per project)
+
+#include "BenchComparison.h"
+#include "Benchmarks.h"
+#include "Workloads.h"
+#include "objectbox.hpp"
+#include "util/PerfCounters.h"
+#include "util/Tracing.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: objectbox_ts_bench [options]    runs the workload matrix on a database\n"
+                 "       objectbox_ts_bench micro [name|all] [count]    runs micro benchmarks (no database)\n"
+                 "       objectbox_ts_bench compare <baseline.json> <current.json> [compare options]\n"
+                 "           compares two results files; exits with 2 if there are regressions\n"
+                 "Options (lists are comma separated; counts accept k, M and B suffixes, e.g. 1B):\n"
+                 "  --workloads <list>    import,put,range-query,linked-query,min-max,migrate-packed,retention\n"
+                 "                        (default: all)\n"
+                 "  --sizes <list>        data set sizes in objects (default: 1M)\n"
+                 "  --batch-sizes <list>  objects per put (default: 1k,10k,100k)\n"
+                 "  --widths <list>       range query widths in ms (default: 1000,60000,3600000)\n"
+                 "  --warmup <n>          untimed runs before the timed ones (default: 1)\n"
+                 "  --repeats <n>         timed runs (default: 5)\n"
+                 "  --queries <n>         queries (and min/max lookups) per run (default: 100)\n"
+                 "  --retention <f>       fraction of the time span removed per retention run (default: 0.1)\n"
+                 "  --seed <n>            for the random query positions (default: 42)\n"
+                 "  --dir <directory>     database directory, its DB files are removed (default: objectbox-bench)\n"
+                 "  --out <file>          JSON results (default: objectbox-bench.json)\n"
+                 "  --trace <file>        also writes a Chrome trace of all runs (view e.g. in ui.perfetto.dev)\n"
+                 "  --perf                adds CPU performance counters (cycles, cache misses, ...) to the results\n"
+                 "Compare options:\n"
+                 "  --threshold <percent>  significant throughput drops beyond this are regressions (default: 5)\n"
+                 "  --confidence <level>   of the confidence intervals and significance test (default: 0.95)\n"
+                 "  --latency-threshold <percent>  p99 latency increases beyond this are regressions (default: off)"
+              << std::endl;
+}
+
+/// Parses a count like 1000, 10k, 1M or 1B
+uint64_t parseCount(const std::string& text) {
+    char* end = nullptr;
+    double value = strtod(text.c_str(), &end);
+    uint64_t multiplier = 1;
+    if (*end == 'k' || *end == 'K') multiplier = 1000;
+    if (*end == 'M') multiplier = 1000000;
+    if (*end == 'B' || *end == 'G') multiplier = 1000000000;
+    if (multiplier > 1) end++;
+    if (end == text.c_str() || *end != '\0' || value < 0) throw std::invalid_argument("Invalid count: " + text);
+    return static_cast<uint64_t>(value * multiplier + 0.5);
+}
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+std::vector<uint64_t> parseCounts(const std::string& text) {
+    std::vector<uint64_t> counts;
+    for (const std::string& item : splitList(text)) counts.push_back(parseCount(item));
+    return counts;
+}
+
+/// objectbox_ts_bench compare <baseline.json> <current.json> [options]
+int compare(int argc, char* args[]) {
+    ComparisonOptions options;
+    std::vector<std::string> paths;
+    for (int i = 2; i < argc; ++i) {
+        std::string option = args[i];
+        if (option.compare(0, 2, "--") != 0) {
+            paths.push_back(option);
+            continue;
+        }
+        double* target = option == "--threshold"           ? &options.thresholdPercent
+                         : option == "--confidence"        ? &options.confidence
+                         : option == "--latency-threshold" ? &options.latencyThresholdPercent
+                                                           : nullptr;
+        if (!target || i + 1 >= argc) {
+            std::cerr << (target ? "Missing value for " : "Unknown option ") << option << std::endl;
+            printUsage();
+            return 1;
+        }
+        *target = atof(args[++i]);
+    }
+    if (paths.size() != 2 || options.confidence <= 0 || options.confidence >= 1) {
+        printUsage();
+        return 1;
+    }
+    try {
+        return compareReportFiles(paths[0], paths[1], options) > 0 ? 2 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Comparison failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* args[]) {
+    if (argc >= 2 && strcmp(args[1], "micro") == 0) {
+        // Micro benchmarks do not need a store: objectbox_ts_bench micro [name] [count]
+        return runBenchmarks(argc >= 3 ? args[2] : "all", argc >= 4 ? atoi(args[3]) : 1000000) ? 0 : 1;
+    }
+    if (argc >= 2 && strcmp(args[1], "compare") == 0) return compare(argc, args);  // no store either
+
+    WorkloadConfig config;
+    std::string outPath = "objectbox-bench.json";
+    std::string tracePath;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = args[i];
+            if (option == "--help" || option == "-h") {
+                printUsage();
+                return 0;
+            }
+            if (option == "--perf") {
+                PerfCounters::enable();
+                continue;
+            }
+            if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + option);
+            std::string value = args[++i];
+            if (option == "--workloads") {
+                config.workloads = splitList(value);
+            } else if (option == "--sizes") {
+                config.datasetSizes = parseCounts(value);
+            } else if (option == "--batch-sizes") {
+                config.batchSizes = parseCounts(value);
+            } else if (option == "--widths") {
+                std::vector<uint64_t> widths = parseCounts(value);
+                config.rangeWidths.assign(widths.begin(), widths.end());
+            } else if (option == "--warmup") {
+                config.warmupRuns = static_cast<int>(parseCount(value));
+            } else if (option == "--repeats") {
+                config.repeats = static_cast<int>(parseCount(value));
+            } else if (option == "--queries") {
+                config.queriesPerRun = parseCount(value);
+            } else if (option == "--retention") {
+                config.retentionFraction = atof(value.c_str());
+            } else if (option == "--seed") {
+                config.seed = parseCount(value);
+            } else if (option == "--dir") {
+                config.directory = value;
+            } else if (option == "--out") {
+                outPath = value;
+            } else if (option == "--trace") {
+                tracePath = value;
+            } else {
+                throw std::invalid_argument("Unknown option " + option);
+            }
+        }
+        for (uint64_t count : config.batchSizes) {
+            if (count == 0) throw std::invalid_argument("Batch sizes must not be zero");
+        }
+        if (config.repeats < 1) throw std::invalid_argument("At least one repeat is required");
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    std::cout << "ObjectBox TS benchmark using ObjectBox library " << obx_version_string()
+              << " (core: " << obx_version_core_string() << ")" << std::endl;
+    if (!obx_has_feature(OBXFeature_TimeSeries)) {
+        std::cout << "This benchmark requires ObjectBox TS, a special time series edition." << std::endl;
+        std::cout << "To get ObjectBox TS, please visit https://objectbox.io/time-series-database/." << std::endl;
+        return 1;
+    }
+
+    if (!tracePath.empty()) Tracer::enable();
+    std::vector<WorkloadResult> results;
+    try {
+        results = runWorkloads(config);
+        if (!tracePath.empty()) {
+            std::cout << "Wrote " << Tracer::writeJson(tracePath) << " trace events to " << tracePath << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+    std::ofstream out(outPath);
+    out << workloadReportJson(config, results);
+    if (!out) {
+        std::cerr << "Could not write results to " << outPath << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << results.size() << " results to " << outPath << std::endl;
+    return 0;
+}
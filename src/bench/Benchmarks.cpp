@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmarks.h"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+using namespace objectbox::tsdemo;
+
+namespace {
+
+struct NamedBenchmark {
+    const char* name;
+    void (*function)(int count);
+};
+
+const NamedBenchmark kBenchmarks[] = {
+    {"quantization", benchQuantization},
+    {"columnar-scan", benchColumnarScan},
+    {"columnar-import", benchColumnarImport},
+    {"decode", benchDecode},
+    {"arena", benchArena},
+    {"batch-serialize", benchBatchSerialize},
+    {"parallel-serialize", benchParallelSerialize},
+    {"verify", benchVerify},
+    {"tags", benchTags},
+    {"reflection", benchReflection},
+    {"text-export", benchTextExport},
+    {"numbers", benchNumbers},
+    {"hash", benchHash},
+    {"intern", benchIntern},
+    {"view", benchView},
+    {"fields", benchFields},
+    {"columns", benchColumns},
+    {"packed", benchPacked},
+    {"histogram", benchHistogram},
+    {"timer", benchTimer},
+};
+
+}  // namespace
+
+bool objectbox::tsdemo::runBenchmarks(const char* name, int count) {
+    bool all = strcmp(name, "all") == 0;
+    bool found = false;
+    bool failed = false;
+    for (const NamedBenchmark& benchmark : kBenchmarks) {
+        if (all || strcmp(name, benchmark.name) == 0) {
+            std::cout << "=== Benchmark " << benchmark.name << " (count: " << count << ")" << std::endl;
+            try {
+                benchmark.function(count);
+            } catch (const std::exception& e) {
+                std::cerr << "Benchmark " << benchmark.name << " failed: " << e.what() << std::endl;
+                failed = true;
+            }
+            found = true;
+        }
+    }
+    if (!found) {
+        std::cout << "Unknown benchmark \"" << name << "\"; available: all";
+        for (const NamedBenchmark& benchmark : kBenchmarks) std::cout << ", " << benchmark.name;
+        std::cout << std::endl;
+    }
+    return found && !failed;
+}
+
+void FlatBufferSet::reserve(size_t count, size_t bytesPerBuffer) {
+    offsets_.reserve(count);
+    sizes_.reserve(count);
+    storage_.reserve(count * ((bytesPerBuffer + 7) / 8));
+}
+
+void FlatBufferSet::add(const uint8_t* data, size_t size) {
+    size_t offset = storage_.size() * sizeof(uint64_t);
+    storage_.resize(storage_.size() + (size + 7) / 8);
+    memcpy(reinterpret_cast<uint8_t*>(storage_.data()) + offset, data, size);
+    offsets_.push_back(offset);
+    sizes_.push_back(size);
+}
+
+size_t FlatBufferSet::totalSize() const {
+    size_t total = 0;
+    for (size_t size : sizes_) total += size;
+    return total;
+}
+
+std::vector<OBX_bytes> FlatBufferSet::toBytes() const {
+    std::vector<OBX_bytes> objects(count());
+    for (size_t i = 0; i < count(); ++i) objects[i] = OBX_bytes{data(i), size(i)};
+    return objects;
+}
+
+void objectbox::tsdemo::toFlatBufferOtherLayout(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object) {
+    fbb.Clear();
+    flatbuffers::uoffset_t fbStart = fbb.StartTable();
+    fbb.AddElement(20, object.loadCpu4);
+    fbb.AddElement(18, object.loadCpu3);
+    fbb.AddElement(16, object.loadCpu2);
+    fbb.AddElement(14, object.loadCpu1);
+    fbb.AddElement(12, object.temperatureCpu);
+    fbb.AddElement(10, object.temperatureInside);
+    fbb.AddElement(8, object.temperatureOutside);
+    fbb.AddElement(6, object.time);
+    fbb.AddElement(4, object.id);
+    flatbuffers::Offset<flatbuffers::Table> offset;
+    offset.o = fbb.EndTable(fbStart);
+    fbb.Finish(offset);
+}
+
+std::vector<NamedTimeRange> objectbox::tsdemo::createNamedTimeRanges(size_t count) {
+    static const char* const names[] = {"green", "red", "yellow", "maintenance", "night-shift", "weekend",
+                                        "maintenance-window-building-a", "maintenance-window-building-b",
+                                        "calibration-sensor-outside", "calibration-sensor-inside",
+                                        "load-test-cpu-cluster-1", "load-test-cpu-cluster-2", "heating-season-2025",
+                                        "cooling-season-2026"};
+    const size_t nameCount = sizeof(names) / sizeof(names[0]);
+    std::vector<NamedTimeRange> ranges(count);
+    for (size_t i = 0; i < count; ++i) {
+        int64_t begin = static_cast<int64_t>(i) * 1000;
+        ranges[i] = NamedTimeRange{i + 1, begin, begin + 500, names[i * 5 % nameCount]};
+    }
+    return ranges;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_BENCHMARKS_H
+#define OBJECTBOX_BENCHMARKS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "ts-data-model.obx.hpp"
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Runs the micro benchmark with the given name, or all of them for "all".
+/// @param count number of objects (or other items) to process; interpreted by each benchmark
+/// A benchmark fails by throwing (e.g. if a result check fails); the others still run.
+/// @returns false if there is no benchmark with the given name or if one failed
+bool runBenchmarks(const char* name, int count);
+
+/// Many FlatBuffers stored back-to-back (8 byte aligned), e.g. to simulate object data read from the database
+class FlatBufferSet {
+    std::vector<uint64_t> storage_;  // uint64_t for alignment
+    std::vector<size_t> offsets_;
+    std::vector<size_t> sizes_;
+
+public:
+    void reserve(size_t count, size_t bytesPerBuffer);
+
+    /// Appends a copy of the finished buffer of the given builder
+    void add(const flatbuffers::FlatBufferBuilder& fbb) { add(fbb.GetBufferPointer(), fbb.GetSize()); }
+
+    /// Appends a copy of the given buffer
+    void add(const uint8_t* data, size_t size);
+
+    size_t count() const { return offsets_.size(); }
+
+    const uint8_t* data(size_t index) const {
+        return reinterpret_cast<const uint8_t*>(storage_.data()) + offsets_[index];
+    }
+
+    size_t size(size_t index) const { return sizes_[index]; }
+
+    /// Sum of all buffer sizes (excluding alignment padding)
+    size_t totalSize() const;
+
+    /// All buffers as OBX_bytes (pointing into this set), e.g. like collected from a query
+    std::vector<OBX_bytes> toBytes() const;
+};
+
+/// Writes a valid SensorValues FlatBuffer with the fields in reverse order, i.e. not matching SensorValuesLayout,
+/// to measure the fallback paths of layout-specific code
+void toFlatBufferOtherLayout(flatbuffers::FlatBufferBuilder& fbb, const SensorValues& object);
+
+/// Consecutive time ranges reusing a few names (of which some exceed the std::string inline capacity)
+std::vector<NamedTimeRange> createNamedTimeRanges(size_t count);
+
+// Individual benchmarks; each prints its results to stdout and throws std::runtime_error if a check fails
+void benchQuantization(int count);
+void benchColumnarScan(int count);
+void benchColumnarImport(int count);
+void benchDecode(int count);
+void benchArena(int count);
+void benchBatchSerialize(int count);
+void benchParallelSerialize(int count);
+void benchVerify(int count);
+void benchTags(int count);
+void benchReflection(int count);
+void benchTextExport(int count);
+void benchNumbers(int count);
+void benchHash(int count);
+void benchIntern(int count);
+void benchView(int count);
+void benchFields(int count);
+void benchColumns(int count);
+void benchPacked(int count);
+void benchHistogram(int count);
+void benchTimer(int count);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_BENCHMARKS_H
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "ColumnarExport.h"
+#include "ColumnarImport.h"
+#include "DemoData.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+double megabytesPerSecond(uint64_t bytes, uint64_t nanos) { return nanos ? bytes * 1000.0 / nanos : 0; }
+
+}  // namespace
+
+void objectbox::tsdemo::benchColumnarScan(int count) {
+    const char* path = "bench-columnar.obxcol";
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+
+    StopWatch stopWatch;
+    {
+        ColumnarFileWriter writer(path, sensorValuesColumns());
+        for (const SensorValues& object : values) {
+            uint32_t row = writer.addRow();
+            writer.column<int64_t>(ColumnId)[row] = static_cast<int64_t>(object.id);
+            writer.column<int64_t>(ColumnTime)[row] = object.time;
+            writer.column<double>(ColumnTemperatureOutside)[row] = object.temperatureOutside;
+            writer.column<double>(ColumnTemperatureInside)[row] = object.temperatureInside;
+            writer.column<double>(ColumnTemperatureCpu)[row] = object.temperatureCpu;
+            writer.column<double>(ColumnLoadCpu1)[row] = object.loadCpu1;
+            writer.column<double>(ColumnLoadCpu2)[row] = object.loadCpu2;
+            writer.column<double>(ColumnLoadCpu3)[row] = object.loadCpu3;
+            writer.column<double>(ColumnLoadCpu4)[row] = object.loadCpu4;
+        }
+        writer.close();
+    }
+    uint64_t writeNanos = stopWatch.durationInNanos();
+
+    stopWatch.reset();
+    ColumnarFileReader reader(path);
+    uint64_t openNanos = stopWatch.durationInNanos();
+    std::cout << "Wrote " << reader.rowCount() << " rows (" << reader.size() << " bytes, " << reader.blockCount()
+              << " blocks) in " << StopWatch::durationForLog(writeNanos) << " ("
+              << megabytesPerSecond(reader.size(), writeNanos) << " MB/s); mapped in "
+              << StopWatch::durationForLog(openNanos) << std::endl;
+
+    // Full column scan straight from the mapping
+    int column = reader.findColumn("temperatureOutside");
+    stopWatch.reset();
+    double sum = 0;
+    for (size_t block = 0; block < reader.blockCount(); ++block) {
+        const double* data = reader.columnData<double>(block, column);
+        uint64_t rows = reader.blockRowCount(block);
+        for (uint64_t i = 0; i < rows; ++i) sum += data[i];
+    }
+    uint64_t scanNanos = stopWatch.durationInNanos();
+    std::cout << "Column scan: " << StopWatch::durationForLog(scanNanos) << " ("
+              << megabytesPerSecond(reader.rowCount() * sizeof(double), scanNanos) << " MB/s, checksum " << sum
+              << ")" << std::endl;
+
+    // Time window covering 10 % of the data: block min/max of the time column allows skipping most blocks
+    int timeColumn = reader.findColumn("time");
+    int64_t timeBegin = values[values.size() * 4 / 10].time;
+    int64_t timeEnd = values[values.size() / 2].time;
+    stopWatch.reset();
+    uint64_t matches = 0;
+    sum = 0;
+    size_t skipped = 0;
+    for (size_t block = 0; block < reader.blockCount(); ++block) {
+        const columnar::ColumnBlockInfo& timeInfo = reader.columnInfo(block, timeColumn);
+        if (timeInfo.max.i < timeBegin || timeInfo.min.i > timeEnd) {
+            skipped++;
+            continue;
+        }
+        const int64_t* times = reader.columnData<int64_t>(block, timeColumn);
+        const double* data = reader.columnData<double>(block, column);
+        uint64_t rows = reader.blockRowCount(block);
+        for (uint64_t i = 0; i < rows; ++i) {
+            bool match = times[i] >= timeBegin && times[i] <= timeEnd;
+            matches += match;
+            sum += match ? data[i] : 0.0;
+        }
+    }
+    std::cout << "Time window scan: " << stopWatch.durationForLog() << ", " << matches << " matches (checksum " << sum
+              << "), " << skipped << " of " << reader.blockCount() << " blocks skipped" << std::endl;
+    remove(path);
+}
+
+void objectbox::tsdemo::benchColumnarImport(int count) {
+    const char* path = "bench-columnar.obxcol";
+    int64_t now = millisSinceEpoch();
+    exportSensorValues(createSensorValueData(now, count, false), path);
+
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);
+
+    // What a put of std::vector<SensorValues> needs: objects first, then one FlatBuffer per object
+    StopWatch stopWatch;
+    std::vector<SensorValues> values = createSensorValueData(now, count, false);
+    uint64_t bytes = 0;
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        bytes += fbb.GetSize();
+    }
+    uint64_t objectNanos = stopWatch.durationInNanos();
+    std::cout << "Objects to FlatBuffers: " << StopWatch::durationForLog(objectNanos) << " ("
+              << static_cast<double>(objectNanos) / count << " ns/object, " << bytes << " bytes)" << std::endl;
+
+    // Import path: FlatBuffers straight from the mapped columns
+    stopWatch.reset();
+    ColumnarFileReader reader(path);
+    SensorValuesColumnSource source(reader);
+    bytes = 0;
+    size_t mismatches = 0;
+    flatbuffers::FlatBufferBuilder fbbObjects;
+    fbbObjects.ForceDefaults(true);
+    uint64_t index = 0;
+    uint64_t checkNanos = 0;
+    for (size_t block = 0; block < reader.blockCount(); ++block) {
+        source.selectBlock(block);
+        for (uint64_t row = 0; row < reader.blockRowCount(block); ++row, ++index) {
+            source.writeRow(fbb, row);
+            bytes += fbb.GetSize();
+            if (index % 1024 == 0) {  // Spot check: both paths must produce identical bytes
+                StopWatch checkWatch;
+                SensorValues::_OBX_MetaInfo::toFlatBuffer(fbbObjects, values[index]);
+                if (fbb.GetSize() != fbbObjects.GetSize() ||
+                    memcmp(fbb.GetBufferPointer(), fbbObjects.GetBufferPointer(), fbb.GetSize()) != 0) {
+                    mismatches++;
+                }
+                checkNanos += checkWatch.durationInNanos();
+            }
+        }
+    }
+    uint64_t columnNanos = stopWatch.durationInNanos() - checkNanos;
+    std::cout << "Columns to FlatBuffers: " << StopWatch::durationForLog(columnNanos) << " ("
+              << static_cast<double>(columnNanos) / count << " ns/object, " << bytes << " bytes, " << mismatches
+              << " mismatches)" << std::endl;
+    remove(path);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesBatch.h"
+#include "SensorValuesColumns.h"
+#include "SensorValuesLayout.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Best of several passes
+template <typename Fn>
+void run(const char* name, size_t count, Fn fn) {
+    uint64_t nanos = UINT64_MAX;
+    double checksum = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        checksum = fn();
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << "  " << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / count << " ns/object (checksum " << checksum << ")" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchColumns(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    for (size_t i = 0; i < values.size(); ++i) values[i].id = i + 1;
+    SensorValuesBatch batch;
+    batch.serialize(values);
+    std::vector<OBX_bytes> objects(batch.count());
+    for (size_t i = 0; i < batch.count(); ++i) objects[i] = batch.object(i);
+
+    SensorValuesColumns columns = SensorValuesColumns::fromFlatBuffers(objects.data(), objects.size());
+    SensorValuesBatch columnBatch;
+    columns.toFlatBuffers(columnBatch);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < batch.count(); ++i) {
+        const OBX_bytes& a = batch.object(i);
+        const OBX_bytes& b = columnBatch.object(i);
+        mismatches += a.size != b.size || memcmp(a.data, b.data, a.size) != 0;
+    }
+    std::cout << "Round-trip mismatches (FlatBuffers -> columns -> FlatBuffers): " << mismatches << std::endl;
+
+    std::cout << "From FlatBuffers:" << std::endl;
+    run("std::vector<SensorValues>", objects.size(), [&]() {
+        std::vector<SensorValues> decoded(objects.size());
+        for (size_t i = 0; i < objects.size(); ++i) {
+            SensorValuesFastDecoder::fromFlatBuffer(objects[i].data, objects[i].size, decoded[i]);
+        }
+        return decoded.back().loadCpu4;
+    });
+    run("SensorValuesColumns::fromFlatBuffers()", objects.size(), [&]() {
+        return SensorValuesColumns::fromFlatBuffers(objects.data(), objects.size()).loadCpu4.back();
+    });
+
+    std::cout << "To FlatBuffers (SensorValuesBatch):" << std::endl;
+    run("std::vector<SensorValues>", values.size(), [&]() {
+        batch.serialize(values);
+        return static_cast<double>(batch.sizeInBytes());
+    });
+    run("SensorValuesColumns::toFlatBuffers()", columns.size(), [&]() {
+        columns.toFlatBuffers(columnBatch);
+        return static_cast<double>(columnBatch.sizeInBytes());
+    });
+
+    // Typical analytics: average CPU load and max. outside temperature
+    std::cout << "Scan (average load of 4 CPUs, max. temperatureOutside):" << std::endl;
+    run("std::vector<SensorValues>", values.size(), [&]() {
+        double load = 0, maxTemperature = -1e300;
+        for (const SensorValues& object : values) {
+            load += object.loadCpu1 + object.loadCpu2 + object.loadCpu3 + object.loadCpu4;
+            maxTemperature = std::max(maxTemperature, object.temperatureOutside);
+        }
+        return load / (4 * values.size()) + maxTemperature;
+    });
+    run("SensorValuesColumns", columns.size(), [&]() {
+        double load = 0, maxTemperature = -1e300;
+        for (size_t i = 0; i < columns.size(); ++i) {
+            load += columns.loadCpu1[i] + columns.loadCpu2[i] + columns.loadCpu3[i] + columns.loadCpu4[i];
+            maxTemperature = std::max(maxTemperature, columns.temperatureOutside[i]);
+        }
+        return load / (4 * columns.size()) + maxTemperature;
+    });
+}
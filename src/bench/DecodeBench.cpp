@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesLayout.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Best of several passes to reduce noise
+template <typename DecodeFn>
+void decodeAll(const char* name, const FlatBufferSet& buffers, DecodeFn decode) {
+    uint64_t nanos = UINT64_MAX;
+    double sum = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        SensorValues object;
+        sum = 0;
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            decode(buffers.data(i), buffers.size(i), object);
+            // Use all fields, so the compiler cannot drop any reads of the (inlined) fast decoder
+            sum += static_cast<double>(object.id + object.time) + object.temperatureOutside +
+                   object.temperatureInside + object.temperatureCpu + object.loadCpu1 + object.loadCpu2 +
+                   object.loadCpu3 + object.loadCpu4;
+        }
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / buffers.count() << " ns/object (checksum " << sum << ")" << std::endl;
+}
+
+// Function objects (not function pointers), so decoders can be inlined
+struct GenericDecoder {
+    void operator()(const uint8_t* data, size_t size, SensorValues& out) const {
+        SensorValues::_OBX_MetaInfo::fromFlatBuffer(data, size, out);
+    }
+};
+
+struct FastDecoder {
+    void operator()(const uint8_t* data, size_t size, SensorValues& out) const {
+        SensorValuesFastDecoder::fromFlatBuffer(data, size, out);
+    }
+};
+
+}  // namespace
+
+void objectbox::tsdemo::benchDecode(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet fixedLayout, otherLayout;
+    fixedLayout.reserve(values.size(), 104);
+    otherLayout.reserve(values.size(), 104);
+    flatbuffers::FlatBufferBuilder fbb;
+    flatbuffers::FlatBufferBuilder fbbOther;
+    fbb.ForceDefaults(true);
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        fixedLayout.add(fbb);
+        toFlatBufferOtherLayout(fbbOther, object);
+        otherLayout.add(fbbOther);
+    }
+
+    // Verify that the fast path decodes exactly what the generated code decodes
+    size_t mismatches = 0;
+    for (size_t i = 0; i < fixedLayout.count(); ++i) {
+        SensorValues expected, actual;
+        GenericDecoder()(fixedLayout.data(i), fixedLayout.size(i), expected);
+        FastDecoder()(fixedLayout.data(i), fixedLayout.size(i), actual);
+        if (memcmp(&expected, &actual, sizeof(SensorValues)) != 0) mismatches++;
+    }
+    std::cout << "Fast decoder mismatches: " << mismatches << std::endl;
+
+    decodeAll("Generated decoder", fixedLayout, GenericDecoder());
+    decodeAll("Fast decoder (fixed layout)", fixedLayout, FastDecoder());
+    decodeAll("Fast decoder (fallback, other layout)", otherLayout, FastDecoder());
+}
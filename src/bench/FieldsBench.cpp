@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "DemoSchema.h"
+#include "SensorValuesFields.h"
+#include "util/CompiledReflection.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// The alternative without field types: switch on the field for each value
+double readRuntime(const flatbuffers::Table* table, int field) {
+    switch (field) {
+        case 0: return static_cast<double>(table->GetField<obx_id>(4, 0));
+        case 1: return static_cast<double>(table->GetField<int64_t>(6, 0));
+        default: return table->GetField<double>(static_cast<flatbuffers::voffset_t>(4 + 2 * field), 0);
+    }
+}
+
+double getRuntime(const SensorValues& object, int field) {
+    switch (field) {
+        case 0: return static_cast<double>(object.id);
+        case 1: return static_cast<double>(object.time);
+        case 2: return object.temperatureOutside;
+        case 3: return object.temperatureInside;
+        case 4: return object.temperatureCpu;
+        case 5: return object.loadCpu1;
+        case 6: return object.loadCpu2;
+        case 7: return object.loadCpu3;
+        default: return object.loadCpu4;
+    }
+}
+
+template <typename ReadFn>
+FieldSummary<double> summarizeRuntime(size_t count, ReadFn read) {
+    FieldSummary<double> summary{std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(), 0, count};
+    for (size_t i = 0; i < count; ++i) {
+        double value = read(i);
+        summary.min = std::min(summary.min, value);
+        summary.max = std::max(summary.max, value);
+        summary.sum += value;
+    }
+    return summary;
+}
+
+/// Summarizes each field with the template kernel (one instantiation per field)
+struct SummarizeBuffers {
+    const std::vector<OBX_bytes>& objects;
+    double& checksum;
+
+    template <typename Field>
+    void operator()(Field) const {
+        FieldSummary<typename Field::ValueType> summary = summarize<Field>(objects.data(), objects.size());
+        checksum += summary.sum + static_cast<double>(summary.max) - static_cast<double>(summary.min);
+    }
+};
+
+struct SummarizeObjects {
+    const std::vector<SensorValues>& objects;
+    double& checksum;
+
+    template <typename Field>
+    void operator()(Field) const {
+        FieldSummary<typename Field::ValueType> summary = summarize<Field>(objects.data(), objects.size());
+        checksum += summary.sum + static_cast<double>(summary.max) - static_cast<double>(summary.min);
+    }
+};
+
+/// Best of several passes
+template <typename Fn>
+void run(const char* name, size_t count, Fn fn) {
+    uint64_t nanos = UINT64_MAX;
+    double checksum = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        checksum = 0;
+        fn(checksum);
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / (count * SensorValuesFields::kCount) << " ns/value (checksum "
+              << checksum << ")" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchFields(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    for (size_t i = 0; i < values.size(); ++i) values[i].id = i + 1;
+    FlatBufferSet buffers;
+    flatbuffers::FlatBufferBuilder fbb;
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        buffers.add(fbb);
+    }
+    std::vector<OBX_bytes> objects = buffers.toBytes();
+    std::cout << "Min/max/sum of all " << SensorValuesFields::kCount << " fields:" << std::endl;
+
+    run("FlatBuffers, switch per value", objects.size(), [&](double& checksum) {
+        for (int field = 0; field < SensorValuesFields::kCount; ++field) {
+            FieldSummary<double> summary = summarizeRuntime(objects.size(), [&](size_t i) {
+                return readRuntime(flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data), field);
+            });
+            checksum += summary.sum + summary.max - summary.min;
+        }
+    });
+    std::vector<uint8_t> schemaBuffer = buildDemoSchema();
+    CompiledObject compiled(*reflection::GetSchema(schemaBuffer.data())->objects()->LookupByKey(
+        "objectbox.tsdemo.SensorValues"));
+    run("FlatBuffers, CompiledField accessor per value", objects.size(), [&](double& checksum) {
+        for (const CompiledField& field : compiled.fields()) {
+            FieldSummary<double> summary = summarizeRuntime(objects.size(), [&](size_t i) {
+                return field.getDouble(*flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data));
+            });
+            checksum += summary.sum + summary.max - summary.min;
+        }
+    });
+    run("FlatBuffers, template kernel per field", objects.size(),
+        [&](double& checksum) { SensorValuesFields::forEach(SummarizeBuffers{objects, checksum}); });
+    run("Objects, switch per value", values.size(), [&](double& checksum) {
+        for (int field = 0; field < SensorValuesFields::kCount; ++field) {
+            FieldSummary<double> summary =
+                summarizeRuntime(values.size(), [&](size_t i) { return getRuntime(values[i], field); });
+            checksum += summary.sum + summary.max - summary.min;
+        }
+    });
+    run("Objects, template kernel per field", values.size(),
+        [&](double& checksum) { SensorValuesFields::forEach(SummarizeObjects{values, checksum}); });
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "Benchmarks.h"
+#include "flatbuffers/hash.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Random keys of the given length range; zero terminated for the FNV functions (which use strlen semantics)
+std::vector<std::string> createKeys(size_t count, size_t minLength, size_t maxLength) {
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<size_t> length(minLength, maxLength);
+    std::uniform_int_distribution<int> character('a', 'z');
+    std::vector<std::string> keys(count);
+    for (std::string& key : keys) {
+        key.resize(length(random));
+        for (char& c : key) c = static_cast<char>(character(random));
+    }
+    return keys;
+}
+
+template <typename HashFn>
+void run(const char* name, const std::vector<std::string>& keys, size_t rounds, HashFn hash) {
+    size_t bytes = 0;
+    for (const std::string& key : keys) bytes += key.size();
+    StopWatch stopWatch;
+    uint64_t checksum = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        for (const std::string& key : keys) checksum += hash(key);
+    }
+    uint64_t nanos = stopWatch.durationInNanos();
+    double hashes = static_cast<double>(keys.size()) * rounds;
+    std::cout << "  " << name << ": " << nanos / hashes << " ns/key, " << bytes * rounds / static_cast<double>(nanos)
+              << " GB/s (checksum " << checksum % 1000 << ")" << std::endl;
+}
+
+void compare(const char* title, size_t keyCount, size_t minLength, size_t maxLength, size_t totalBytes) {
+    std::vector<std::string> keys = createKeys(keyCount, minLength, maxLength);
+    size_t bytes = 0;
+    for (const std::string& key : keys) bytes += key.size();
+    size_t rounds = std::max<size_t>(1, totalBytes / bytes);
+    std::cout << title << " (" << minLength << "-" << maxLength << " bytes, " << keys.size() * rounds
+              << " hashes):" << std::endl;
+    run("fnv1a_64", keys, rounds,
+        [](const std::string& key) { return flatbuffers::HashFnv1a<uint64_t>(key.c_str()); });
+    run("wyhash_64", keys, rounds, [](const std::string& key) { return flatbuffers::HashWyhash64(key.c_str()); });
+    run("wyhash_64 (length given)", keys, rounds,
+        [](const std::string& key) { return flatbuffers::HashWyhash64(key.data(), key.size()); });
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchHash(int count) {
+    // Names like NamedTimeRange.name or tag keys/values
+    std::vector<std::string> keys = createKeys(static_cast<size_t>(count), 4, 24);
+    std::unordered_set<uint64_t> hashes;
+    std::unordered_set<std::string> distinctKeys(keys.begin(), keys.end());
+    for (const std::string& key : distinctKeys) hashes.insert(flatbuffers::HashWyhash64(key.data(), key.size()));
+    std::cout << "wyhash_64 collisions among " << distinctKeys.size()
+              << " distinct short keys: " << distinctKeys.size() - hashes.size() << std::endl;
+
+    size_t totalBytes = static_cast<size_t>(count) * 64;
+    compare("Short keys", static_cast<size_t>(count), 4, 24, totalBytes);
+    compare("Medium keys", 10000, 32, 128, totalBytes);
+    compare("Long keys", 100, 4096, 16384, totalBytes);
+}
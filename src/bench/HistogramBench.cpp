@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Benchmarks.h"
+#include "util/LatencyHistogram.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Log-normally distributed latencies around 50 µs with a long tail, like put/query durations
+std::vector<uint64_t> createSamples(size_t count) {
+    std::mt19937_64 random(42);
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 1.0);
+    std::vector<uint64_t> samples(count);
+    for (uint64_t& sample : samples) sample = static_cast<uint64_t>(distribution(random));
+    return samples;
+}
+
+/// Records all samples split across the given number of threads, each thread either recording to the shared
+/// histogram directly or to its own one, which is merged into the shared one at the end
+void recordParallel(const std::vector<uint64_t>& samples, unsigned threadCount, bool threadLocal) {
+    LatencyHistogram shared;
+    StopWatch stopWatch;
+    std::vector<std::thread> threads;
+    size_t slice = (samples.size() + threadCount - 1) / threadCount;
+    for (unsigned t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            size_t begin = std::min(samples.size(), t * slice);
+            size_t end = std::min(samples.size(), begin + slice);
+            if (threadLocal) {
+                LatencyHistogram local;
+                for (size_t i = begin; i < end; ++i) local.record(samples[i]);
+                shared.merge(local);
+            } else {
+                for (size_t i = begin; i < end; ++i) shared.record(samples[i]);
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << "  " << threadCount << " thread(s), " << (threadLocal ? "thread-local + merge" : "shared") << ": "
+              << static_cast<double>(nanos) / samples.size() << " ns/sample"
+              << (shared.count() == samples.size() ? "" : " (ERROR: samples lost)") << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchHistogram(int count) {
+    std::vector<uint64_t> samples = createSamples(static_cast<size_t>(count));
+
+    // Accuracy: percentiles vs. the exact values of the sorted samples
+    LatencyHistogram histogram("lognormal");
+    for (uint64_t sample : samples) histogram.record(sample);
+    std::vector<uint64_t> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    std::cout << histogram.summary() << std::endl;
+    for (double percent : {50.0, 90.0, 99.0, 99.9, 100.0}) {
+        size_t rank = std::max<size_t>(1, static_cast<size_t>(percent / 100 * sorted.size() + 0.5));
+        uint64_t exact = sorted[rank - 1];
+        uint64_t reported = histogram.percentile(percent);
+        std::cout << "  p" << percent << ": " << reported << " ns (exact " << exact << " ns, error "
+                  << 100.0 * (static_cast<double>(reported) - exact) / exact << " %)" << std::endl;
+    }
+    std::cout << "  " << histogram.toJson() << std::endl;
+
+    // Overhead of recording, including a StopWatch per sample (as used to time operations)
+    StopWatch stopWatch;
+    uint64_t checksum = 0;
+    for (uint64_t sample : samples) {
+        StopWatch sampleStopWatch;
+        checksum += sample;
+        histogram.record(sampleStopWatch);
+    }
+    std::cout << "StopWatch + record: " << static_cast<double>(stopWatch.durationInNanos()) / samples.size()
+              << " ns/sample (checksum " << checksum % 1000 << ")" << std::endl;
+
+    std::cout << "Record:" << std::endl;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        recordParallel(samples, threads, false);
+        recordParallel(samples, threads, true);
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <string>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "Benchmarks.h"
+#include "NamedTimeRangeCodec.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Heap bytes in use incl. large (mmap) blocks (glibc only; 0 otherwise)
+size_t heapInUse() {
+#ifdef __GLIBC__
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchIntern(int count) {
+    std::vector<NamedTimeRange> ranges = createNamedTimeRanges(static_cast<size_t>(count));
+
+    // One FlatBuffer per object like ObjectBox stores them
+    FlatBufferSet buffers;
+    flatbuffers::FlatBufferBuilder fbb;
+    for (const NamedTimeRange& object : ranges) {
+        NamedTimeRange::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        buffers.add(fbb);
+    }
+    ranges = std::vector<NamedTimeRange>();
+
+    {
+        size_t heapBefore = heapInUse();
+        StopWatch stopWatch;
+        std::vector<NamedTimeRange> decoded(buffers.count());
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            NamedTimeRange::_OBX_MetaInfo::fromFlatBuffer(buffers.data(i), buffers.size(i), decoded[i]);
+        }
+        uint64_t nanos = stopWatch.durationInNanos();
+        size_t allocations = 0;  // a std::string only allocates if its content exceeds the inline (SSO) capacity
+        for (const NamedTimeRange& object : decoded) allocations += object.name.capacity() > std::string().capacity();
+        std::cout << "NamedTimeRange (std::string): " << static_cast<double>(nanos) / decoded.size()
+                  << " ns/object, " << allocations << " string allocations, "
+                  << (heapInUse() - heapBefore) / (1024.0 * 1024) << " MB heap" << std::endl;
+    }
+
+    {
+        StringPool pool;
+        size_t heapBefore = heapInUse();
+        StopWatch stopWatch;
+        std::vector<InternedNamedTimeRange> decoded(buffers.count());
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            NamedTimeRangeCodec::fromFlatBuffer(buffers.data(i), buffers.size(i), decoded[i], pool);
+        }
+        uint64_t nanos = stopWatch.durationInNanos();
+        std::cout << "InternedNamedTimeRange: " << static_cast<double>(nanos) / decoded.size() << " ns/object, "
+                  << pool.count() << " distinct names (pool: " << pool.memoryUsage() << " bytes), "
+                  << (heapInUse() - heapBefore) / (1024.0 * 1024) << " MB heap" << std::endl;
+
+        // Bulk: all objects in one FlatBuffer, with and without shared names
+        std::vector<NamedTimeRange> objects;
+        objects.reserve(decoded.size());
+        for (const InternedNamedTimeRange& object : decoded) {
+            objects.push_back(NamedTimeRangeCodec::toNamedTimeRange(object));
+        }
+        NamedTimeRangeCodec::toFlatBuffer(fbb, objects.data(), objects.size(), false);  // warm up (buffer growth)
+        for (bool shareNames : {false, true}) {
+            StopWatch stopWatchBulk;
+            NamedTimeRangeCodec::toFlatBuffer(fbb, objects.data(), objects.size(), shareNames);
+            uint64_t nanosBulk = stopWatchBulk.durationInNanos();
+            std::cout << "Bulk FlatBuffer " << (shareNames ? "CreateSharedString(): " : "CreateString():       ")
+                      << static_cast<double>(nanosBulk) / objects.size() << " ns/object, "
+                      << fbb.GetSize() / (1024.0 * 1024) << " MB" << std::endl;
+        }
+        NamedTimeRangeCodec::fromFlatBuffer(fbb.GetBufferPointer(), fbb.GetSize(), decoded, pool);
+        size_t mismatches = 0;
+        for (size_t i = 0; i < decoded.size(); ++i) {
+            mismatches += decoded[i].id != objects[i].id || decoded[i].name.str() != objects[i].name;
+        }
+        std::cout << "Bulk round-trip mismatches: " << mismatches << std::endl;
+    }
+}
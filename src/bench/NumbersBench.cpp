@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "util/FastNumbers.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+const size_t kPoolSize = 1000000;  // numbers are reused to reach the requested count
+
+/// The previous approach: snprintf with increasing precision until strtod gives back the value
+size_t formatDoubleSnprintf(double value, char* out) {
+    int length = 0;
+    for (int precision = 15; precision <= 17; ++precision) {
+        length = snprintf(out, kMaxDoubleLength, "%.*g", precision, value);
+        if (precision == 17 || strtod(out, nullptr) == value) break;
+    }
+    return static_cast<size_t>(length);
+}
+
+/// Text of all pool numbers, zero terminated (for strtod) and back-to-back
+struct TextPool {
+    std::vector<char> text;
+    std::vector<size_t> offsets;
+
+    const char* get(size_t index) const { return text.data() + offsets[index]; }
+    size_t length(size_t index) const { return offsets[index + 1] - offsets[index] - 1; }
+};
+
+template <typename Fn>
+void run(const char* name, size_t count, Fn fn) {
+    StopWatch stopWatch;
+    double checksum = 0;
+    for (size_t i = 0; i < count; ++i) checksum += fn(i % kPoolSize);
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", " << static_cast<double>(nanos) / count
+              << " ns/number, " << count * 1000.0 / nanos << " M numbers/s (checksum " << checksum << ")"
+              << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchNumbers(int count) {
+    // Mix of sensor values (mostly 16-17 significant digits), short decimals and random magnitudes
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), kPoolSize / 4, false);
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> distribution(-100, 100);
+    std::vector<double> numbers;
+    numbers.reserve(kPoolSize);
+    for (const SensorValues& object : values) {
+        numbers.push_back(object.temperatureOutside);
+        numbers.push_back(object.loadCpu1);
+        numbers.push_back(std::round(distribution(random) * 100) / 100);
+        numbers.push_back(distribution(random) * std::pow(10.0, static_cast<int>(random() % 20) - 10));
+    }
+
+    TextPool pool;
+    char text[kMaxDoubleLength];
+    size_t formatMismatches = 0, parseMismatches = 0;
+    for (double number : numbers) {
+        size_t length = formatDouble(number, text);
+        char reference[kMaxDoubleLength];
+        size_t referenceLength = formatDoubleSnprintf(number, reference);
+        if (length != referenceLength || memcmp(text, reference, length) != 0) formatMismatches++;
+        pool.offsets.push_back(pool.text.size());
+        pool.text.insert(pool.text.end(), text, text + length);
+        pool.text.push_back(0);
+        double parsed;
+        if (!parseDouble(text, text + length, &parsed) || parsed != number) parseMismatches++;
+    }
+    pool.offsets.push_back(pool.text.size());
+    std::cout << "Mismatches: formatting (vs. snprintf) " << formatMismatches << ", parsing (round trip) "
+              << parseMismatches << std::endl;
+
+    // Share of numbers that take the snprintf/strtod fallbacks, per kind (in the order they were added above)
+    const char* kinds[] = {"sensor temperatureOutside", "sensor loadCpu1", "short decimals", "random magnitudes"};
+    size_t formatFallbacks[4] = {}, parseFallbacks[4] = {}, kindCounts[4] = {};
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        kindCounts[i % 4]++;
+        if (!formatDoubleIsFast(numbers[i])) formatFallbacks[i % 4]++;
+        if (!parseDoubleIsFast(pool.get(i), pool.get(i) + pool.length(i))) parseFallbacks[i % 4]++;
+    }
+    std::cout << "Fallbacks (formatting/parsing):" << std::endl;
+    for (int kind = 0; kind < 4; ++kind) {
+        std::cout << "  " << kinds[kind] << ": " << 100.0 * formatFallbacks[kind] / kindCounts[kind] << " % / "
+                  << 100.0 * parseFallbacks[kind] / kindCounts[kind] << " %" << std::endl;
+    }
+
+    size_t n = static_cast<size_t>(count);
+    run("Format snprintf/strtod", n, [&](size_t i) { return formatDoubleSnprintf(numbers[i], text); });
+    run("Format formatDouble()", n, [&](size_t i) { return formatDouble(numbers[i], text); });
+    run("Parse strtod", n, [&](size_t i) { return strtod(pool.get(i), nullptr); });
+    run("Parse parseDouble()", n, [&](size_t i) {
+        double value = 0;
+        parseDouble(pool.get(i), pool.get(i) + pool.length(i), &value);
+        return value;
+    });
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesLayout.h"
+#include "SensorValuesPacking.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Best of several passes over all buffers; readFn returns a value to sum up (so the compiler cannot skip reads)
+template <typename ReadFn>
+void scan(const char* name, const FlatBufferSet& buffers, ReadFn read) {
+    uint64_t nanos = UINT64_MAX;
+    double sum = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        sum = 0;
+        for (size_t i = 0; i < buffers.count(); ++i) sum += read(buffers.data(i), buffers.size(i));
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << "  " << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / buffers.count() << " ns/object (checksum " << sum << ")" << std::endl;
+}
+
+double sumFields(const SensorValues& object) {
+    return object.temperatureOutside + object.temperatureInside + object.temperatureCpu + object.loadCpu1 +
+           object.loadCpu2 + object.loadCpu3 + object.loadCpu4;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchPacked(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet tables, packed;
+    tables.reserve(values.size(), 96);
+    packed.reserve(values.size(), 104);
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);  // All fields present like for objects with an assigned ID
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        tables.add(fbb);
+        SensorValuesPacking::toFlatBuffer(fbb, object);
+        packed.add(fbb);
+    }
+    std::cout << "Storage size: SensorValues " << tables.totalSize() / values.size() << " bytes/object, "
+              << "SensorValuesPacked " << packed.totalSize() / values.size() << " bytes/object" << std::endl;
+
+    size_t mismatches = 0;
+    SensorValues decoded;
+    SensorValuesPacked generated;
+    for (size_t i = 0; i < values.size(); ++i) {
+        SensorValuesPacking::fromFlatBuffer(packed.data(i), packed.size(i), decoded);
+        SensorValuesPacked::_OBX_MetaInfo::fromFlatBuffer(packed.data(i), packed.size(i), generated);
+        SensorValues unpacked = SensorValuesPacking::unpack(generated);
+        mismatches += memcmp(&decoded, &values[i], sizeof(SensorValues)) != 0 ||
+                      memcmp(&unpacked, &values[i], sizeof(SensorValues)) != 0;
+    }
+    std::cout << "Round-trip mismatches: " << mismatches << std::endl;
+
+    std::cout << "Decode all fields:" << std::endl;
+    SensorValues object;
+    scan("SensorValues (generated binding)", tables, [&](const uint8_t* data, size_t size) {
+        SensorValues::_OBX_MetaInfo::fromFlatBuffer(data, size, object);
+        return sumFields(object);
+    });
+    scan("SensorValues (SensorValuesFastDecoder)", tables, [&](const uint8_t* data, size_t size) {
+        SensorValuesFastDecoder::fromFlatBuffer(data, size, object);
+        return sumFields(object);
+    });
+    scan("SensorValuesPacked (generated binding)", packed, [&](const uint8_t* data, size_t size) {
+        SensorValuesPacked::_OBX_MetaInfo::fromFlatBuffer(data, size, generated);
+        return generated.payload[0] + generated.payload[6];
+    });
+    scan("SensorValuesPacked (SensorValuesPacking)", packed, [&](const uint8_t* data, size_t size) {
+        SensorValuesPacking::fromFlatBuffer(data, size, object);
+        return sumFields(object);
+    });
+
+    std::cout << "Scan loadCpu1..4 directly on the buffers:" << std::endl;
+    scan("SensorValues table fields", tables, [](const uint8_t* data, size_t) {
+        const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+        return table->GetField<double>(14, 0) + table->GetField<double>(16, 0) + table->GetField<double>(18, 0) +
+               table->GetField<double>(20, 0);
+    });
+    scan("SensorValuesPacked payload", packed, [](const uint8_t* data, size_t) {
+        const auto* payload =
+            flatbuffers::GetRoot<flatbuffers::Table>(data)->GetPointer<const flatbuffers::Vector<double>*>(8);
+        return payload->Get(3) + payload->Get(4) + payload->Get(5) + payload->Get(6);
+    });
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "ParallelIngest.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+void objectbox::tsdemo::benchParallelSerialize(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+
+    // The consumer stands in for the single writer; it only reads the object data (a put would copy it)
+    for (unsigned threads = 1; threads <= 16; threads *= 2) {
+        ParallelSerializer serializer(threads);
+        uint64_t nanos = UINT64_MAX;
+        size_t bytes = 0;
+        uint64_t checksum = 0;
+        for (int pass = 0; pass < 3; ++pass) {
+            bytes = 0;
+            checksum = 0;
+            StopWatch stopWatch;
+            serializer.run(values.data(), values.size(), [&](SensorValuesBatch& chunk) {
+                for (size_t i = 0; i < chunk.count(); ++i) {
+                    const OBX_bytes& object = chunk.object(i);
+                    const uint64_t* data = static_cast<const uint64_t*>(object.data);
+                    for (size_t j = 0; j < object.size / 8; ++j) checksum += data[j];
+                    bytes += object.size;
+                }
+            });
+            nanos = std::min(nanos, stopWatch.durationInNanos());
+        }
+        std::cout << threads << " serialization thread(s): " << StopWatch::durationForLog(nanos) << ", "
+                  << static_cast<double>(nanos) / values.size() << " ns/object, "
+                  << static_cast<double>(bytes) / nanos << " GB/s (checksum " << checksum << ")" << std::endl;
+    }
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+}
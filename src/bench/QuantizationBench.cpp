@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesQuantization.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+double relativeError(double original, double decoded) {
+    return original == 0 ? std::fabs(decoded) : std::fabs((decoded - original) / original);
+}
+
+/// Decodes all objects and sums up the quantized properties (so the compiler cannot skip decoding)
+template <typename DecodeFn>
+void scan(const char* name, const FlatBufferSet& buffers, DecodeFn decode) {
+    StopWatch stopWatch;
+    SensorValues object;
+    double sum = 0;
+    for (size_t i = 0; i < buffers.count(); ++i) {
+        decode(buffers.data(i), buffers.size(i), object);
+        sum += object.temperatureOutside + object.loadCpu1 + object.loadCpu2 + object.loadCpu3 + object.loadCpu4;
+    }
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << name << " scan: " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / buffers.count() << " ns/object (checksum " << sum << ")" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchQuantization(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+
+    FlatBufferSet plain, quantized;
+    plain.reserve(values.size(), 96);
+    quantized.reserve(values.size(), 80);
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);  // All fields present like for objects with an assigned ID
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        plain.add(fbb);
+        SensorValuesQuantization::toFlatBuffer(fbb, object);
+        quantized.add(fbb);
+    }
+    std::cout << "Storage size: SensorValues " << plain.totalSize() / values.size() << " bytes/object, "
+              << "SensorValuesQuantized " << quantized.totalSize() / values.size() << " bytes/object ("
+              << 100.0 * quantized.totalSize() / plain.totalSize() << " %)" << std::endl;
+
+    // Check the observed errors against the documented bounds (temperatures outside of the range are clamped)
+    const LinearQuantizer<int16_t>& temperatureQuantizer = SensorValuesQuantization::temperatureOutside;
+    double maxErrorTemperature = 0, maxRelativeErrorLoad = 0;
+    size_t clampedTemperatures = 0;
+    SensorValues decoded;
+    for (size_t i = 0; i < values.size(); ++i) {
+        const SensorValues& original = values[i];
+        SensorValuesQuantization::fromFlatBuffer(quantized.data(i), quantized.size(i), decoded);
+        if (original.temperatureOutside < temperatureQuantizer.minValue() ||
+            original.temperatureOutside > temperatureQuantizer.maxValue()) {
+            clampedTemperatures++;
+        } else {
+            maxErrorTemperature =
+                std::max(maxErrorTemperature, std::fabs(decoded.temperatureOutside - original.temperatureOutside));
+        }
+        for (double error : {relativeError(original.loadCpu1, decoded.loadCpu1),
+                             relativeError(original.loadCpu2, decoded.loadCpu2),
+                             relativeError(original.loadCpu3, decoded.loadCpu3),
+                             relativeError(original.loadCpu4, decoded.loadCpu4)}) {
+            maxRelativeErrorLoad = std::max(maxRelativeErrorLoad, error);
+        }
+    }
+    std::cout << "Max. error temperatureOutside: " << maxErrorTemperature << " (bound "
+              << temperatureQuantizer.maxError() << "; " << clampedTemperatures << " values out of range)"
+              << std::endl;
+    std::cout << "Max. relative error loadCpu1..4: " << maxRelativeErrorLoad << " (bound "
+              << SensorValuesQuantization::loadCpu.maxRelativeError() << ")" << std::endl;
+    if (maxErrorTemperature > temperatureQuantizer.maxError() ||
+        maxRelativeErrorLoad > SensorValuesQuantization::loadCpu.maxRelativeError()) {
+        throw std::runtime_error("Observed quantization error exceeds its documented bound");
+    }
+
+    scan("SensorValues", plain, [](const uint8_t* data, size_t size, SensorValues& out) {
+        SensorValues::_OBX_MetaInfo::fromFlatBuffer(data, size, out);
+    });
+    scan("SensorValuesQuantized", quantized, [](const uint8_t* data, size_t size, SensorValues& out) {
+        SensorValuesQuantization::fromFlatBuffer(data, size, out);
+    });
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "DemoSchema.h"
+#include "SensorValuesQuantization.h"
+#include "util/CompiledReflection.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// What flatbuffers::GetAnyFieldF() does: field metadata and type switch per call (GetAnyValueF() is not header-only)
+double interpretedGetDouble(const flatbuffers::Table& table, const reflection::Field& field) {
+    const uint8_t* p = table.GetAddressOf(field.offset());
+    if (!p) return field.default_real();
+    switch (field.type()->base_type()) {
+        case reflection::Short: return flatbuffers::ReadScalar<int16_t>(p);
+        case reflection::Int: return flatbuffers::ReadScalar<int32_t>(p);
+        case reflection::Long: return static_cast<double>(flatbuffers::ReadScalar<int64_t>(p));
+        case reflection::ULong: return static_cast<double>(flatbuffers::ReadScalar<uint64_t>(p));
+        case reflection::Float: return flatbuffers::ReadScalar<float>(p);
+        case reflection::Double: return flatbuffers::ReadScalar<double>(p);
+        default: return 0;
+    }
+}
+
+/// Best of several passes; extractFn fills the column for all objects
+template <typename ExtractFn>
+void extractColumn(const char* name, std::vector<double>& column, ExtractFn extract) {
+    uint64_t nanos = UINT64_MAX;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        extract(column.data());
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    double sum = 0;
+    for (double value : column) sum += value;
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / column.size() << " ns/object (checksum " << sum << ")" << std::endl;
+}
+
+void benchEntity(const reflection::Schema& schema, const char* entity, const char* fieldName,
+                 const std::vector<OBX_bytes>& objects) {
+    const reflection::Object* object = schema.objects()->LookupByKey(entity);
+    const reflection::Field* field = object->fields()->LookupByKey(fieldName);
+    CompiledObject compiled(*object);
+    const CompiledField& compiledField = *compiled.field(fieldName);
+    std::cout << entity << "." << fieldName << " (" << reflection::EnumNameBaseType(compiledField.type())
+              << "):" << std::endl;
+
+    std::vector<double> column(objects.size());
+    extractColumn("  Interpreted (like GetAnyFieldF)", column, [&](double* out) {
+        for (size_t i = 0; i < objects.size(); ++i) {
+            out[i] = interpretedGetDouble(*flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data), *field);
+        }
+    });
+    extractColumn("  CompiledField::getDouble()", column, [&](double* out) {
+        for (size_t i = 0; i < objects.size(); ++i) {
+            out[i] = compiledField.getDouble(*flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data));
+        }
+    });
+    extractColumn("  CompiledField::extractDoubles()", column, [&](double* out) {
+        compiledField.extractDoubles(objects.data(), objects.size(), out);
+    });
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchReflection(int count) {
+    std::vector<uint8_t> schemaBuffer = buildDemoSchema();
+    const reflection::Schema& schema = *reflection::GetSchema(schemaBuffer.data());
+
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet plain, quantized;
+    plain.reserve(values.size(), 104);
+    quantized.reserve(values.size(), 80);
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        plain.add(fbb);
+        SensorValuesQuantization::toFlatBuffer(fbb, object);
+        quantized.add(fbb);
+    }
+    std::vector<OBX_bytes> plainObjects = plain.toBytes();
+    std::vector<OBX_bytes> quantizedObjects = quantized.toBytes();
+
+    // Reference: what generated code does for a single field
+    std::vector<double> column(plainObjects.size());
+    extractColumn("Generated-style accessor SensorValues.temperatureOutside", column, [&](double* out) {
+        for (size_t i = 0; i < plainObjects.size(); ++i) {
+            out[i] = flatbuffers::GetRoot<flatbuffers::Table>(plainObjects[i].data)->GetField<double>(8, 0);
+        }
+    });
+
+    benchEntity(schema, "objectbox.tsdemo.SensorValues", "temperatureOutside", plainObjects);
+    benchEntity(schema, "objectbox.tsdemo.SensorValues", "time", plainObjects);
+    benchEntity(schema, "objectbox.tsdemo.SensorValuesQuantized", "temperatureOutside", quantizedObjects);
+    benchEntity(schema, "objectbox.tsdemo.SensorValuesQuantized", "loadCpu1", quantizedObjects);
+}
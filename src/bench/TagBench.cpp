@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include "Benchmarks.h"
+#include "util/HashedTagMap.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+const size_t kDistinctTagMaps = 4096;  // samples refer to a pool of tag buffers to keep memory usage low
+
+/// Looks up 3 tags per sample; Lookup creates the map view from the buffer (as a scan would per sample)
+template <typename LookupFn>
+void lookupAll(const char* name, const FlatBufferSet& buffers, size_t sampleCount, LookupFn lookup) {
+    uint64_t nanos = UINT64_MAX;
+    size_t found = 0;
+    for (int pass = 0; pass < 3; ++pass) {
+        StopWatch stopWatch;
+        found = 0;
+        for (size_t i = 0; i < sampleCount; ++i) {
+            size_t index = (i * 2654435761u) % buffers.count();  // spread accesses over the pool
+            found += lookup(buffers.data(index), buffers.size(index));
+        }
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / sampleCount << " ns/sample (" << found << " tags found)" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchTags(int count) {
+    const char* keys[] = {"location", "firmware", "unit",   "building", "floor",  "room",
+                          "vendor",   "model",    "serial", "owner",    "region", "rack"};
+    FlatBufferSet plain, hashed;
+    flexbuffers::Builder fbb;
+    HashedTagMapBuilder builder;
+    for (size_t i = 0; i < kDistinctTagMaps; ++i) {
+        fbb.Clear();
+        fbb.Map([&]() {
+            for (const char* key : keys) fbb.String(key, std::string(key) + "-" + std::to_string(i % 97));
+            fbb.Int("revision", static_cast<int64_t>(i));
+        });
+        fbb.Finish();
+        plain.add(fbb.GetBuffer().data(), fbb.GetBuffer().size());
+
+        for (const char* key : keys) builder.addString(key, std::string(key) + "-" + std::to_string(i % 97));
+        builder.addInt("revision", static_cast<int64_t>(i));
+        builder.finish(fbb);
+        hashed.add(fbb.GetBuffer().data(), fbb.GetBuffer().size());
+    }
+    std::cout << "Tag buffer size: plain map " << plain.totalSize() / kDistinctTagMaps << " bytes, with hash index "
+              << hashed.totalSize() / kDistinctTagMaps << " bytes" << std::endl;
+
+    // Samples (count) refer to the tag buffers; each lookup includes a missing key
+    size_t sampleCount = static_cast<size_t>(count);
+    lookupAll("flexbuffers::Map::operator[]", plain, sampleCount, [](const uint8_t* data, size_t size) {
+        flexbuffers::Map map = flexbuffers::GetRoot(data, size).AsMap();
+        return !map["location"].IsNull() + !map["unit"].IsNull() + !map["calibration"].IsNull();
+    });
+    const TagKey location("location"), unit("unit"), calibration("calibration");
+    lookupAll("HashedTagMap (precomputed key hashes)", hashed, sampleCount, [&](const uint8_t* data, size_t size) {
+        HashedTagMap map(data, size);
+        return !map[location].IsNull() + !map[unit].IsNull() + !map[calibration].IsNull();
+    });
+    lookupAll("HashedTagMap (fallback, plain map)", plain, sampleCount, [&](const uint8_t* data, size_t size) {
+        HashedTagMap map(data, size);
+        return !map[location].IsNull() + !map[unit].IsNull() + !map[calibration].IsNull();
+    });
+}
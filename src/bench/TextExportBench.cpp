@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesLayout.h"
+#include "TextExport.h"
+#include "flatbuffers/minireflect.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+// The ObjectBox generator does not emit mini reflection tables (flatc --reflect-names), so define it here
+const flatbuffers::TypeCode kSensorValuesTypeCodes[] = {
+    {flatbuffers::ET_ULONG, 0, -1},  {flatbuffers::ET_LONG, 0, -1},   {flatbuffers::ET_DOUBLE, 0, -1},
+    {flatbuffers::ET_DOUBLE, 0, -1}, {flatbuffers::ET_DOUBLE, 0, -1}, {flatbuffers::ET_DOUBLE, 0, -1},
+    {flatbuffers::ET_DOUBLE, 0, -1}, {flatbuffers::ET_DOUBLE, 0, -1}, {flatbuffers::ET_DOUBLE, 0, -1}};
+const char* const kSensorValuesNames[] = {"id",       "time",     "temperatureOutside", "temperatureInside",
+                                          "temperatureCpu", "loadCpu1", "loadCpu2", "loadCpu3", "loadCpu4"};
+const flatbuffers::TypeTable kSensorValuesTypeTable = {
+    flatbuffers::ST_TABLE, 9, kSensorValuesTypeCodes, nullptr, nullptr, nullptr, kSensorValuesNames};
+
+const char* kNullDevice = "/dev/null";
+
+void printThroughput(const char* name, uint64_t nanos, uint64_t bytes, size_t count) {
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", " << static_cast<double>(nanos) / count
+              << " ns/object, " << static_cast<double>(bytes) * 1000 / nanos << " MB/s" << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchTextExport(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet buffers;
+    buffers.reserve(values.size(), 104);
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.ForceDefaults(true);
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        buffers.add(fbb);
+    }
+
+    // Check round trips of doubles and timestamps against the C library
+    size_t doubleMismatches = 0, timestampMismatches = 0;
+    char text[BufferedTextWriter::kMaxFormattedLength + 1];
+    for (size_t i = 0; i < std::min<size_t>(values.size(), 100000); ++i) {
+        const SensorValues& object = values[i];
+        for (double value : {object.temperatureOutside, object.loadCpu1, object.loadCpu4}) {
+            text[BufferedTextWriter::formatDouble(value, text)] = 0;
+            if (strtod(text, nullptr) != value) doubleMismatches++;
+        }
+        int64_t millis = object.time - static_cast<int64_t>(i) * 86400000 * 3;  // also cover past dates
+        text[BufferedTextWriter::formatTimestamp(millis, text)] = 0;
+        time_t seconds = static_cast<time_t>(millis >= 0 ? millis / 1000 : (millis - 999) / 1000);
+        char expected[40];
+        size_t length = strftime(expected, sizeof(expected), "%Y-%m-%dT%H:%M:%S", gmtime(&seconds));
+        if (strncmp(text, expected, length) != 0) timestampMismatches++;
+    }
+    std::cout << "Round-trip mismatches: doubles " << doubleMismatches << ", timestamps " << timestampMismatches
+              << std::endl;
+
+    // Mini reflection (one std::string per object), written to the null device
+    {
+        StopWatch stopWatch;
+        FILE* file = fopen(kNullDevice, "wb");
+        uint64_t bytes = 0;
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            std::string line = flatbuffers::FlatBufferToString(buffers.data(i), &kSensorValuesTypeTable);
+            line += '\n';
+            fwrite(line.data(), 1, line.size(), file);
+            bytes += line.size();
+        }
+        fclose(file);
+        printThroughput("minireflect FlatBufferToString()", stopWatch.durationInNanos(), bytes, buffers.count());
+    }
+
+    for (TextFormat format : {TextFormat::JsonLines, TextFormat::Csv}) {
+        StopWatch stopWatch;
+        BufferedTextWriter out(kNullDevice);
+        SensorValuesTextWriter writer(out, format);
+        SensorValues object;
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            SensorValuesFastDecoder::fromFlatBuffer(buffers.data(i), buffers.size(i), object);
+            writer.write(object);
+        }
+        writer.finish();
+        out.close();
+        const char* name =
+            format == TextFormat::JsonLines ? "SensorValuesTextWriter JSON lines" : "SensorValuesTextWriter CSV";
+        printThroughput(name, stopWatch.durationInNanos(), out.bytesWritten(), buffers.count());
+    }
+}
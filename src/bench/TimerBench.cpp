@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <iostream>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "util/LatencyHistogram.h"
+#include "util/StopWatch.h"
+#include "util/TscStopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Cost of starting and reading a stop watch, i.e. the overhead added to each timed operation
+template <typename StopWatchType>
+void measureOverhead(const char* name, int count) {
+    uint64_t sum = 0;
+    StopWatch stopWatch;
+    for (int i = 0; i < count; ++i) {
+        StopWatchType timer;
+        sum += timer.durationInNanos();
+    }
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << name << " start + read: " << static_cast<double>(nanos) / count << " ns (measured "
+              << static_cast<double>(sum) / count << " ns on average)" << std::endl;
+}
+
+double decode(const FlatBufferSet& buffers, size_t i, SensorValues& object) {
+    SensorValues::_OBX_MetaInfo::fromFlatBuffer(buffers.data(i), buffers.size(i), object);
+    return object.temperatureOutside + object.loadCpu1;
+}
+
+/// Times each decoded object with the given stop watch type; prints the total time including the timing overhead
+template <typename StopWatchType>
+void decodeTimed(const char* name, const FlatBufferSet& buffers, uint64_t untimedNanos) {
+    LatencyHistogram latency(name);
+    SensorValues object;
+    double sum = 0;
+    StopWatch stopWatch;
+    for (size_t i = 0; i < buffers.count(); ++i) {
+        StopWatchType timer;
+        sum += decode(buffers, i, object);
+        latency.record(timer.durationInNanos());
+    }
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << name << " per object: " << StopWatch::durationForLog(nanos) << ", overhead "
+              << (static_cast<double>(nanos) - untimedNanos) / buffers.count() << " ns/object (checksum " << sum
+              << ")\n  " << latency.summary() << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchTimer(int count) {
+    std::cout << "TscClock: " << TscClock::description() << std::endl;
+    measureOverhead<StopWatch>("StopWatch", count);
+    measureOverhead<TscStopWatch>("TscStopWatch", count);
+
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet buffers;
+    buffers.reserve(values.size(), 104);
+    flatbuffers::FlatBufferBuilder fbb;
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        buffers.add(fbb);
+    }
+
+    SensorValues object;
+    double sum = 0;
+    StopWatch stopWatch;
+    for (size_t i = 0; i < buffers.count(); ++i) sum += decode(buffers, i, object);
+    uint64_t untimedNanos = stopWatch.durationInNanos();
+    std::cout << "Decode without timing: " << StopWatch::durationForLog(untimedNanos) << ", "
+              << static_cast<double>(untimedNanos) / buffers.count() << " ns/object (checksum " << sum << ")"
+              << std::endl;
+    decodeTimed<StopWatch>("StopWatch", buffers, untimedNanos);
+    decodeTimed<TscStopWatch>("TscStopWatch", buffers, untimedNanos);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+#include "Benchmarks.h"
+#include "DemoData.h"
+#include "SensorValuesVerifier.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Best of several passes; the verify function returns whether the buffer is valid
+template <typename VerifyFn>
+void verifyAll(const char* name, const FlatBufferSet& buffers, VerifyFn verify) {
+    uint64_t nanos = UINT64_MAX;
+    size_t validCount = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        StopWatch stopWatch;
+        validCount = 0;
+        for (size_t i = 0; i < buffers.count(); ++i) {
+            if (verify(buffers.data(i), buffers.size(i))) validCount++;
+        }
+        nanos = std::min(nanos, stopWatch.durationInNanos());
+    }
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / buffers.count() << " ns/object (" << validCount << " valid)"
+              << std::endl;
+}
+
+struct FastVerifier {
+    bool operator()(const uint8_t* data, size_t size) const { return SensorValuesVerifier::verify(data, size); }
+};
+
+struct GenericVerifier {
+    bool operator()(const uint8_t* data, size_t size) const { return SensorValuesVerifier::verifyGeneric(data, size); }
+};
+
+/// Reads all fields, so the verification cost can be compared to the cost of reading
+template <DataTrust trust>
+struct Reader {
+    bool operator()(const uint8_t* data, size_t size) const {
+        SensorValues object;
+        if (!readSensorValues(data, size, object, trust)) return false;
+        return object.time + object.temperatureOutside + object.loadCpu4 != 0;
+    }
+};
+
+}  // namespace
+
+void objectbox::tsdemo::benchVerify(int count) {
+    std::vector<SensorValues> values = createSensorValueData(millisSinceEpoch(), count, false);
+    FlatBufferSet fixedLayout, otherLayout;
+    fixedLayout.reserve(values.size(), 104);
+    otherLayout.reserve(values.size(), 104);
+    flatbuffers::FlatBufferBuilder fbb;
+    flatbuffers::FlatBufferBuilder fbbOther;
+    fbb.ForceDefaults(true);
+    for (const SensorValues& object : values) {
+        SensorValues::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        fixedLayout.add(fbb);
+        toFlatBufferOtherLayout(fbbOther, object);
+        otherLayout.add(fbbOther);
+    }
+
+    // Corrupted copies: the fast path must never accept anything the generic verifier rejects
+    std::mt19937 random(42);
+    FlatBufferSet corrupted;
+    std::vector<uint8_t> buffer;
+    for (size_t i = 0; i < std::min<size_t>(fixedLayout.count(), 100000); ++i) {
+        buffer.assign(fixedLayout.data(i), fixedLayout.data(i) + fixedLayout.size(i));
+        if (random() % 4 == 0) {
+            buffer.resize(random() % buffer.size());  // truncated
+        } else {
+            buffer[random() % buffer.size()] ^= static_cast<uint8_t>(1 + random() % 255);
+        }
+        corrupted.add(buffer.data(), buffer.size());
+    }
+    size_t fastOnly = 0, rejected = 0;
+    for (size_t i = 0; i < corrupted.count(); ++i) {
+        bool generic = GenericVerifier()(corrupted.data(i), corrupted.size(i));
+        if (!generic) rejected++;
+        if (!generic && FastVerifier()(corrupted.data(i), corrupted.size(i))) fastOnly++;
+    }
+    std::cout << "Corrupted buffers: " << corrupted.count() << ", rejected: " << rejected
+              << ", accepted only by the fast path: " << fastOnly << std::endl;
+
+    verifyAll("Generic verifier", fixedLayout, GenericVerifier());
+    verifyAll("Fixed-schema verifier", fixedLayout, FastVerifier());
+    verifyAll("Fixed-schema verifier (fallback, other layout)", otherLayout, FastVerifier());
+    verifyAll("Read, trusted (no verification)", fixedLayout, Reader<DataTrust::Trusted>());
+    verifyAll("Read, untrusted (fixed-schema verifier)", fixedLayout, Reader<DataTrust::Untrusted>());
+}
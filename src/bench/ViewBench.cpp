@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <memory>
+
+#include "Benchmarks.h"
+#include "NamedTimeRangeView.h"
+#include "util/StopWatch.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+/// Typical visitor work: total duration of all ranges with a given name
+template <typename ReadFn>
+void run(const char* name, const FlatBufferSet& buffers, ReadFn read) {
+    StopWatch stopWatch;
+    int64_t duration = 0;
+    for (size_t i = 0; i < buffers.count(); ++i) duration += read(buffers.data(i), buffers.size(i));
+    uint64_t nanos = stopWatch.durationInNanos();
+    std::cout << name << ": " << StopWatch::durationForLog(nanos) << ", "
+              << static_cast<double>(nanos) / buffers.count() << " ns/object (checksum " << duration << ")"
+              << std::endl;
+}
+
+}  // namespace
+
+void objectbox::tsdemo::benchView(int count) {
+    FlatBufferSet buffers;
+    flatbuffers::FlatBufferBuilder fbb;
+    for (const NamedTimeRange& object : createNamedTimeRanges(static_cast<size_t>(count))) {
+        NamedTimeRange::_OBX_MetaInfo::toFlatBuffer(fbb, object);
+        buffers.add(fbb);
+    }
+
+    const std::string searched = "maintenance-window-building-a";
+    run("NamedTimeRange newFromFlatBuffer() (like Box::getAll())", buffers, [&](const uint8_t* data, size_t size) {
+        std::unique_ptr<NamedTimeRange> object = NamedTimeRange::_OBX_MetaInfo::newFromFlatBuffer(data, size);
+        return object->name == searched ? object->end - object->begin : 0;
+    });
+    NamedTimeRange reused;
+    run("NamedTimeRange fromFlatBuffer() reusing one object", buffers, [&](const uint8_t* data, size_t size) {
+        NamedTimeRange::_OBX_MetaInfo::fromFlatBuffer(data, size, reused);
+        return reused.name == searched ? reused.end - reused.begin : 0;
+    });
+    const StringView searchedView(searched);
+    run("NamedTimeRangeView", buffers, [&](const uint8_t* data, size_t size) {
+        NamedTimeRangeView view = NamedTimeRangeView::fromFlatBuffer(data, size);
+        return view.name == searchedView ? view.end - view.begin : 0;
+    });
+}
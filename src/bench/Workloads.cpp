@@ -0,0 +1,431 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Workloads.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+
+#include "ColumnarExport.h"
+#include "ColumnarImport.h"
+#include "DemoData.h"
+#include "SensorValuesPacking.h"
+#include "objectbox-model.h"
+#include "objectbox.hpp"
+#include "ts-data-model.obx.hpp"
+#include "util/FastNumbers.h"
+#include "util/LatencyHistogram.h"
+#include "util/MemoryUsage.h"
+#include "util/PerfCounters.h"
+#include "util/Tracing.h"
+
+using namespace objectbox;
+using namespace objectbox::tsdemo;
+
+namespace {
+
+const int64_t kStartTime = 1700000000000;  // fixed (2023-11-14) for reproducible data
+const int64_t kIntervalMillis = 20;
+const uint64_t kFillBatchSize = 10000;  // to fill the database if the put workload is not run
+const size_t kImportBatchSize = 10000;  // objects per obx_box_put_many() call of the batched import
+
+uint64_t fileSize(const std::string& path) {
+    struct stat fileStat {};
+    return stat(path.c_str(), &fileStat) == 0 ? static_cast<uint64_t>(fileStat.st_size) : 0;
+}
+
+/// Objects put, found or removed and the time it took in one run of a workload
+struct RunStats {
+    uint64_t operations = 0;
+    uint64_t objects = 0;
+    uint64_t nanos = 0;
+    PerfCounterValues counters;  // if enabled
+
+    void add(uint64_t operationNanos, uint64_t operationObjects, const PerfStopWatch& stopWatch) {
+        operations++;
+        objects += operationObjects;
+        nanos += operationNanos;
+        if (stopWatch.hasCounters()) counters += stopWatch.counters();
+    }
+};
+
+/// Runs the workloads of one data set size; the store is (re)opened for each put run
+class WorkloadRunner {
+    const WorkloadConfig& config_;
+    uint64_t datasetSize_;
+    std::vector<WorkloadResult>& results_;
+    std::unique_ptr<obx::Store> store_;
+
+    int64_t size() const { return static_cast<int64_t>(datasetSize_); }
+
+    int64_t timeSpan() const { return size() * kIntervalMillis; }
+
+    void openStore(bool removeDbFiles) {
+        store_.reset();  // close first
+        if (removeDbFiles && obx_remove_db_files(config_.directory.c_str()) != OBX_SUCCESS) {
+            throw std::runtime_error(std::string("Could not remove DB files: ") + obx_last_error_message());
+        }
+        obx::Options options(create_obx_model());
+        options.directory(config_.directory.c_str());
+        // Room for about 0.5 KB per object (data and index) and at least 1 GB
+        options.maxDbSizeInKb(std::max<uint64_t>(1024 * 1024, datasetSize_ / 2));
+        store_.reset(new obx::Store(options));
+    }
+
+    /// Puts the whole data set (in a new database) in batches, recording the duration of each put
+    RunStats putAll(uint64_t batchSize, LatencyHistogram& latency) {
+        openStore(true);
+        obx::Box<SensorValues> box(*store_);
+        SensorValuesGenerator generator(kStartTime, kIntervalMillis);
+        std::vector<SensorValues> batch;
+        RunStats stats;
+        for (uint64_t remaining = datasetSize_; remaining > 0;) {
+            uint64_t count = std::min(remaining, batchSize);
+            generator.next(batch, count);  // not measured
+            PerfStopWatch stopWatch;
+            box.put(batch);
+            uint64_t nanos = stopWatch.durationInNanos();
+            latency.record(nanos);
+            stats.add(nanos, count, stopWatch);
+            remaining -= count;
+        }
+        return stats;
+    }
+
+    /// Puts the whole data set (in a new database) like the demo: createSensorValueData() and a single put()
+    RunStats createAndPutAll(LatencyHistogram& latency) {
+        openStore(true);
+        obx::Box<SensorValues> box(*store_);
+        PerfStopWatch stopWatch;
+        std::vector<SensorValues> values = createSensorValueData(kStartTime, static_cast<int>(datasetSize_), false);
+        box.put(values);
+        uint64_t nanos = stopWatch.durationInNanos();
+        latency.record(nanos);
+        RunStats stats;
+        stats.add(nanos, values.size(), stopWatch);
+        return stats;
+    }
+
+    /// Imports the whole data set (in a new database) from the given columnar file
+    RunStats importAll(const std::string& path, size_t batchSize, LatencyHistogram& latency) {
+        openStore(true);
+        obx::Box<SensorValues> box(*store_);
+        PerfStopWatch stopWatch;
+        uint64_t count = importSensorValues(*store_, box, path, 64 * 1024 * 1024, batchSize);
+        uint64_t nanos = stopWatch.durationInNanos();
+        latency.record(nanos);
+        RunStats stats;
+        stats.add(nanos, count, stopWatch);
+        return stats;
+    }
+
+    /// Runs warmup and timed runs of a workload and adds the result
+    /// @param runFn RunStats(LatencyHistogram& latency, int run) with runs numbered from 0 (first warmup run)
+    template <typename RunFn>
+    void measure(const char* workload, std::vector<std::pair<std::string, int64_t>> parameters,
+                 const char* unit, bool perObject, RunFn runFn) {
+        WorkloadResult result;
+        result.workload = workload;
+        result.name = workload;
+        for (const std::pair<std::string, int64_t>& parameter : parameters) {
+            result.name += "/" + parameter.first + "=" + std::to_string(parameter.second);
+        }
+        result.parameters = std::move(parameters);
+        result.unit = unit;
+        std::cout << result.name << "..." << std::flush;
+
+        MemoryPhase memory(result.name);  // resets the peak RSS to get the peak of this workload
+        LatencyHistogram warmupLatency;
+        LatencyHistogram latency(result.name);
+        PerfCounterValues counters;
+        int run = 0;
+        for (; run < config_.warmupRuns; ++run) {
+            TraceScope scope(workload, "warmup run", run);
+            runFn(warmupLatency, run);
+        }
+        MemoryUsage timedStart = MemoryUsage::current();
+        for (int i = 0; i < config_.repeats; ++i, ++run) {
+            TraceScope scope(workload, "run", run);
+            RunStats stats = runFn(latency, run);
+            result.operations += stats.operations;
+            result.objects += stats.objects;
+            counters += stats.counters;
+            double count = static_cast<double>(perObject ? stats.objects : stats.operations);
+            result.throughputs.push_back(stats.nanos ? count * 1e9 / stats.nanos : 0);
+        }
+        result.latencyJson = latency.toJson();
+        if (PerfCounters::enabled()) result.countersJson = counters.toJson();
+        MemoryUsage usage = memory.usage();
+        MemoryUsage timedUsage = MemoryUsage::current().since(timedStart);
+        result.rssBytes = usage.rssBytes;
+        result.peakRssBytes = usage.peakRssBytes;
+        result.allocations = timedUsage.allocations;
+        result.allocatedBytes = timedUsage.allocatedBytes;
+        result.dbSizeBytes = fileSize(config_.directory + "/data.mdb");
+        std::cout << " " << static_cast<uint64_t>(result.meanThroughput()) << " " << unit << "; "
+                  << latency.summary() << std::endl;
+        if (PerfCounters::enabled()) std::cout << "  " << counters.toString() << std::endl;
+        results_.push_back(std::move(result));
+    }
+
+    void runPut() {
+        for (uint64_t batchSize : config_.batchSizes) {
+            measure("put", {{"size", size()}, {"batch", static_cast<int64_t>(batchSize)}}, "objects/s", true,
+                    [&](LatencyHistogram& latency, int) { return putAll(batchSize, latency); });
+        }
+    }
+
+    /// Importing a columnar file (one put call per object and batched) vs. creating the objects and putting them
+    /// like the demo; all with the same rows, each run into a new database
+    void runImport() {
+        if (datasetSize_ > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            std::cout << "import: skipped, createSensorValueData() creates at most " << std::numeric_limits<int>::max()
+                      << " objects" << std::endl;
+            return;
+        }
+        std::string path = config_.directory + "-import.obxcol";
+        exportSensorValues(createSensorValueData(kStartTime, static_cast<int>(datasetSize_), false), path);
+        measure("create-put", {{"size", size()}}, "objects/s", true,
+                [&](LatencyHistogram& latency, int) { return createAndPutAll(latency); });
+        for (size_t batchSize : {static_cast<size_t>(1), kImportBatchSize}) {
+            measure("import", {{"size", size()}, {"batch", static_cast<int64_t>(batchSize)}}, "objects/s", true,
+                    [&](LatencyHistogram& latency, int) { return importAll(path, batchSize, latency); });
+        }
+        remove(path.c_str());
+    }
+
+    void runRangeQueries() {
+        obx::Box<SensorValues> box(*store_);
+        for (int64_t width : config_.rangeWidths) {
+            std::mt19937_64 random(config_.seed + width);
+            std::uniform_int_distribution<int64_t> offset(0, std::max<int64_t>(0, timeSpan() - width));
+            measure("range-query", {{"size", size()}, {"width", width}}, "queries/s", false,
+                    [&](LatencyHistogram& latency, int) {
+                        RunStats stats;
+                        for (uint64_t i = 0; i < config_.queriesPerRun; ++i) {
+                            int64_t begin = kStartTime + offset(random);
+                            obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+                            queryBuilder.with(SensorValues_::time.between(begin, begin + width - 1));
+                            obx::Query<SensorValues> query = queryBuilder.build();
+                            PerfStopWatch stopWatch;
+                            std::vector<SensorValues> found = query.find();
+                            uint64_t nanos = stopWatch.durationInNanos();
+                            latency.record(nanos);
+                            stats.add(nanos, found.size(), stopWatch);
+                        }
+                        return stats;
+                    });
+        }
+    }
+
+    void runLinkedQueries() {
+        obx::Box<SensorValues> box(*store_);
+        obx::Box<NamedTimeRange> boxNTR(*store_);
+        for (int64_t width : config_.rangeWidths) {
+            // One named time range per query of a run, at random positions
+            std::mt19937_64 random(config_.seed + width);
+            std::uniform_int_distribution<int64_t> offset(0, std::max<int64_t>(0, timeSpan() - width));
+            std::vector<NamedTimeRange> ranges;
+            for (uint64_t i = 0; i < config_.queriesPerRun; ++i) {
+                int64_t begin = kStartTime + offset(random);
+                ranges.push_back(NamedTimeRange{0, begin, begin + width - 1, "range-" + std::to_string(i)});
+            }
+            boxNTR.removeAll();
+            boxNTR.put(ranges);
+
+            measure("linked-query", {{"size", size()}, {"width", width}}, "queries/s", false,
+                    [&](LatencyHistogram& latency, int) {
+                        RunStats stats;
+                        for (const NamedTimeRange& range : ranges) {
+                            obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+                            obx::QueryBuilder<NamedTimeRange> rangeBuilder =
+                                queryBuilder.linkTime<NamedTimeRange>(NamedTimeRange_::begin, NamedTimeRange_::end);
+                            rangeBuilder.with(NamedTimeRange_::name.equals(range.name.c_str()));
+                            obx::Query<SensorValues> query = queryBuilder.build();
+                            PerfStopWatch stopWatch;
+                            std::vector<SensorValues> found = query.find();
+                            uint64_t nanos = stopWatch.durationInNanos();
+                            latency.record(nanos);
+                            stats.add(nanos, found.size(), stopWatch);
+                        }
+                        return stats;
+                    });
+        }
+        boxNTR.removeAll();
+    }
+
+    void runMinMax() {
+        obx::Box<SensorValues> box(*store_);
+        measure("min-max", {{"size", size()}}, "lookups/s", false, [&](LatencyHistogram& latency, int) {
+            RunStats stats;
+            for (uint64_t i = 0; i < config_.queriesPerRun; ++i) {
+                int64_t timeMin = 0, timeMax = 0;
+                PerfStopWatch stopWatch;
+                box.timeSeriesMinMax(nullptr, &timeMin, nullptr, &timeMax);
+                uint64_t nanos = stopWatch.durationInNanos();
+                latency.record(nanos);
+                stats.add(nanos, timeMax >= timeMin ? 2 : 0, stopWatch);
+            }
+            return stats;
+        });
+    }
+
+    /// Each run migrates the whole data set to SensorValuesPacked (into an emptied box); afterwards checks that a
+    /// second migration overwrites the objects instead of adding them and that spot-checked objects are unchanged
+    void runMigratePacked() {
+        obx::Box<SensorValues> box(*store_);
+        obx::Box<SensorValuesPacked> boxPacked(*store_);
+        measure("migrate-packed", {{"size", size()}}, "objects/s", true, [&](LatencyHistogram& latency, int) {
+            boxPacked.removeAll();  // not measured
+            PerfStopWatch stopWatch;
+            uint64_t migrated = migrateToPacked(*store_, box, boxPacked, false);
+            uint64_t nanos = stopWatch.durationInNanos();
+            latency.record(nanos);
+            RunStats stats;
+            stats.add(nanos, migrated, stopWatch);
+            return stats;
+        });
+
+        uint64_t count = box.count();
+        if (migrateToPacked(*store_, box, boxPacked, false) != count || boxPacked.count() != count) {
+            throw std::runtime_error("Migrating to SensorValuesPacked again did not overwrite the migrated objects");
+        }
+        obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+        queryBuilder.with(SensorValues_::id.greaterThan(0));
+        for (const SensorValues& object : queryBuilder.build().limit(1000).find()) {
+            std::unique_ptr<SensorValuesPacked> packed = boxPacked.get(object.id);
+            SensorValues unpacked = packed ? SensorValuesPacking::unpack(*packed) : SensorValues();
+            if (!packed || memcmp(&unpacked, &object, sizeof(SensorValues)) != 0) {
+                throw std::runtime_error("Object " + std::to_string(object.id) +
+                                         " differs after migrating to SensorValuesPacked");
+            }
+        }
+        boxPacked.removeAll();
+    }
+
+    /// Each run removes the next oldest part of the data (like a periodic retention job); modifies the data set
+    void runRetention() {
+        obx::Box<SensorValues> box(*store_);
+        int runs = config_.warmupRuns + config_.repeats;
+        double fraction = std::min(config_.retentionFraction, 1.0 / std::max(1, runs));
+        int64_t removeSpan = static_cast<int64_t>(static_cast<double>(timeSpan()) * fraction);
+        int64_t percent = static_cast<int64_t>(fraction * 100 + 0.5);
+        measure("retention", {{"size", size()}, {"percent", percent}}, "objects/s", true,
+                [&](LatencyHistogram& latency, int run) {
+                    obx::QueryBuilder<SensorValues> queryBuilder = box.query();
+                    queryBuilder.with(SensorValues_::time.lessThan(kStartTime + (run + 1) * removeSpan));
+                    obx::Query<SensorValues> query = queryBuilder.build();
+                    PerfStopWatch stopWatch;
+                    uint64_t removed = query.remove();
+                    uint64_t nanos = stopWatch.durationInNanos();
+                    latency.record(nanos);
+                    RunStats stats;
+                    stats.add(nanos, removed, stopWatch);
+                    return stats;
+                });
+    }
+
+public:
+    WorkloadRunner(const WorkloadConfig& config, uint64_t datasetSize, std::vector<WorkloadResult>& results)
+        : config_(config), datasetSize_(datasetSize), results_(results) {}
+
+    void run() {
+        std::cout << "=== Data set size " << datasetSize_ << std::endl;
+        if (config_.hasWorkload("import")) runImport();  // each run uses a new database, so run it before the others
+        if (config_.hasWorkload("put") && !config_.batchSizes.empty()) {
+            runPut();  // leaves the complete data set of the last run
+        } else {
+            TraceScope scope("fill");
+            LatencyHistogram ignored;
+            putAll(kFillBatchSize, ignored);
+        }
+        if (config_.hasWorkload("range-query")) runRangeQueries();
+        if (config_.hasWorkload("linked-query")) runLinkedQueries();
+        if (config_.hasWorkload("min-max")) runMinMax();
+        if (config_.hasWorkload("migrate-packed")) runMigratePacked();
+        if (config_.hasWorkload("retention")) runRetention();  // last: removes data
+    }
+};
+
+void appendJsonArray(std::string& json, const char* name, const std::vector<uint64_t>& values) {
+    json += std::string("\"") + name + "\":[";
+    for (size_t i = 0; i < values.size(); ++i) json += (i ? "," : "") + std::to_string(values[i]);
+    json += "]";
+}
+
+}  // namespace
+
+bool WorkloadConfig::hasWorkload(const std::string& name) const {
+    return std::find(workloads.begin(), workloads.end(), name) != workloads.end();
+}
+
+double WorkloadResult::meanThroughput() const {
+    double sum = 0;
+    for (double throughput : throughputs) sum += throughput;
+    return throughputs.empty() ? 0 : sum / throughputs.size();
+}
+
+std::string WorkloadResult::toJson() const {
+    // Names are plain identifiers chosen by the code, so they need no escaping
+    std::string json = "{\"name\":\"" + name + "\",\"workload\":\"" + workload + "\",\"parameters\":{";
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        json += (i ? ",\"" : "\"") + parameters[i].first + "\":" + std::to_string(parameters[i].second);
+    }
+    json += "},\"unit\":\"" + unit + "\",\"throughput\":" + doubleToString(meanThroughput()) + ",\"throughputs\":[";
+    for (size_t i = 0; i < throughputs.size(); ++i) json += (i ? "," : "") + doubleToString(throughputs[i]);
+    json += "],\"operations\":" + std::to_string(operations) + ",\"objects\":" + std::to_string(objects);
+    json += ",\"latency\":" + latencyJson + ",\"rssBytes\":" + std::to_string(rssBytes);
+    json += ",\"peakRssBytes\":" + std::to_string(peakRssBytes) + ",\"allocations\":" + std::to_string(allocations);
+    json += ",\"allocatedBytes\":" + std::to_string(allocatedBytes) + ",\"dbSizeBytes\":" + std::to_string(dbSizeBytes);
+    if (!countersJson.empty()) json += ",\"counters\":" + countersJson;
+    return json + "}";
+}
+
+std::vector<WorkloadResult> objectbox::tsdemo::runWorkloads(const WorkloadConfig& config) {
+    std::vector<WorkloadResult> results;
+    for (uint64_t size : config.datasetSizes) {
+        WorkloadRunner(config, size, results).run();
+    }
+    return results;
+}
+
+std::string objectbox::tsdemo::workloadReportJson(const WorkloadConfig& config,
+                                                  const std::vector<WorkloadResult>& results) {
+    std::string json = "{\n\"objectboxVersion\":\"" + std::string(obx_version_core_string()) + "\",\n\"config\":{";
+    json += "\"workloads\":[";
+    for (size_t i = 0; i < config.workloads.size(); ++i) json += (i ? ",\"" : "\"") + config.workloads[i] + "\"";
+    json += "],";
+    appendJsonArray(json, "datasetSizes", config.datasetSizes);
+    json += ",";
+    appendJsonArray(json, "batchSizes", config.batchSizes);
+    json += ",";
+    appendJsonArray(json, "rangeWidths",
+                    std::vector<uint64_t>(config.rangeWidths.begin(), config.rangeWidths.end()));
+    json += ",\"warmupRuns\":" + std::to_string(config.warmupRuns) + ",\"repeats\":" + std::to_string(config.repeats);
+    json += ",\"queriesPerRun\":" + std::to_string(config.queriesPerRun);
+    json += ",\"retentionFraction\":" + doubleToString(config.retentionFraction);
+    json += ",\"seed\":" + std::to_string(config.seed) + "},\n\"results\":[";
+    for (size_t i = 0; i < results.size(); ++i) json += (i ? ",\n" : "\n") + results[i].toJson();
+    return json + "\n]\n}\n";
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_WORKLOADS_H
+#define OBJECTBOX_WORKLOADS_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace objectbox {
+namespace tsdemo {
+
+/// Workload matrix run by the objectbox_ts_bench executable; each workload runs for every data set size.
+/// Data is generated deterministically (fixed start time, seeded random query positions), so runs are reproducible.
+struct WorkloadConfig {
+    std::string directory = "objectbox-bench";  // database directory; its DB files are removed before each put run
+    std::vector<std::string> workloads{"import",       "put",     "range-query",
+                                       "linked-query", "min-max", "migrate-packed", "retention"};
+    std::vector<uint64_t> datasetSizes{1000000};             // objects; e.g. up to 1000000000
+    std::vector<uint64_t> batchSizes{1000, 10000, 100000};   // objects per put (transaction)
+    std::vector<int64_t> rangeWidths{1000, 60000, 3600000};  // milliseconds (objects are 20 ms apart)
+    int warmupRuns = 1;
+    int repeats = 5;
+    uint64_t queriesPerRun = 100;
+    double retentionFraction = 0.1;  // of the data set's time span removed per retention run
+    uint64_t seed = 42;
+
+    bool hasWorkload(const std::string& name) const;
+};
+
+/// Results of one cell of the workload matrix over all timed runs (warmup runs are not included)
+struct WorkloadResult {
+    std::string name;  // unique within a run (workload and parameters), e.g. "put/size=1000000/batch=10000"
+    std::string workload;
+    std::vector<std::pair<std::string, int64_t>> parameters;
+    std::string unit;                 // of the throughputs, e.g. "objects/s" or "queries/s"
+    std::vector<double> throughputs;  // one per timed run
+    uint64_t operations = 0;          // timed operations (puts, queries, ...) of all runs
+    uint64_t objects = 0;             // objects put, found or removed in all timed runs
+    std::string latencyJson;          // LatencyHistogram::toJson() of all timed operations
+    uint64_t rssBytes = 0;            // after the last run
+    uint64_t peakRssBytes = 0;        // during this workload (if supported; of the process otherwise)
+    uint64_t allocations = 0;         // operator new calls in all timed runs (see MemoryUsage)
+    uint64_t allocatedBytes = 0;
+    uint64_t dbSizeBytes = 0;
+    std::string countersJson;  // PerfCounterValues::toJson() of all timed operations; empty if counters are disabled
+
+    double meanThroughput() const;
+
+    std::string toJson() const;
+};
+
+/// Runs all configured workloads; prints progress and a summary line per result to stdout.
+/// Throws std::runtime_error on database errors.
+std::vector<WorkloadResult> runWorkloads(const WorkloadConfig& config);
+
+/// The complete report: library version, configuration and results
+std::string workloadReportJson(const WorkloadConfig& config, const std::vector<WorkloadResult>& results);
+
+}  // namespace tsdemo
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_WORKLOADS_H
@@ -14,32 +14,71 @@
  * limitations under the License.
  */
 
-#include <chrono>
-#include <cmath>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
 
 #define OBX_CPP_FILE  // This makes objectbox.hpp emit the definitions (C++ API implementation; needed once per project)
 
+#include "ColumnarExport.h"
+#include "ColumnarImport.h"
+#include "DemoData.h"
+#include "NamedTimeRangeView.h"
+#include "ParallelIngest.h"
+#include "SensorValuesColumns.h"
+#include "SensorValuesPacking.h"
+#include "TextExport.h"
 #include "objectbox-model.h"
 #include "objectbox.hpp"
 #include "ts-data-model.obx.hpp"
+#include "util/LatencyHistogram.h"
+#include "util/MemoryUsage.h"
+#include "util/PerfCounters.h"
 #include "util/StopWatch.h"
+#include "util/Tracing.h"
 
 using namespace objectbox;          // util
 using namespace objectbox::tsdemo;  // our generated code
 
-std::vector<SensorValues> createSensorValueData(int64_t now, int dataCount);
-void putAndPrintNamedTimeRanges(obx::Box<NamedTimeRange>& boxNTR, int64_t start);
-void removeDataBefore(obx::Box<SensorValues> box, int64_t time);
-void buildAndRunQueries(obx::Box<SensorValues>& box, int64_t start);
-void printMinMaxTime(obx::Box<SensorValues>& box, int64_t start);
+/// Latencies of all database operations of the demo
+struct DemoLatencies {
+    LatencyHistogram put{"put"};
+    LatencyHistogram remove{"remove"};
+    LatencyHistogram minMax{"minMax"};
+    LatencyHistogram timeRangeQuery{"timeRangeQuery"};
+    LatencyHistogram columnsQuery{"columnsQuery"};
+    LatencyHistogram linkedQuery{"linkedQuery"};
 
-int64_t millisSinceEpoch() {
-    auto time = std::chrono::system_clock::now().time_since_epoch();
-    return std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
-}
+    void print() const;
+
+    void writeJson(const char* path) const;
+};
+
+/// Writes the trace to the given file (if any) when main() returns
+struct TraceFile {
+    std::string path;
+
+    ~TraceFile() {
+        if (path.empty()) return;
+        try {
+            size_t count = Tracer::writeJson(path);
+            std::cout << "Wrote " << count << " trace events to " << path << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+};
+
+void putAndPrintNamedTimeRanges(obx::Box<NamedTimeRange>& boxNTR, int64_t start);
+void removeDataBefore(obx::Box<SensorValues> box, int64_t time, LatencyHistogram& latency);
+void buildAndRunQueries(obx::Box<SensorValues>& box, int64_t start, DemoLatencies& latencies);
+void printMinMaxTime(obx::Box<SensorValues>& box, int64_t start, LatencyHistogram& latency);
 
 void putTimestamp(int64_t millis) {
     std::time_t timeSeconds = millis / 1000;
@@ -48,6 +87,27 @@ void putTimestamp(int64_t millis) {
 }
 
 int main(int argc, char* args[]) {
+    // Options before the command (if any):
+    //   --trace <file>: writes a Chrome trace of the run (view e.g. in ui.perfetto.dev)
+    //   --perf: logs CPU performance counters (cycles, cache misses, ...) next to durations
+    TraceFile traceFile;
+    while (argc >= 2 && strncmp(args[1], "--", 2) == 0) {
+        if (argc >= 3 && strcmp(args[1], "--trace") == 0) {
+            traceFile.path = args[2];
+            Tracer::enable();
+            Tracer::setThreadName("main");
+            argc--;
+            args++;
+        } else if (strcmp(args[1], "--perf") == 0) {
+            PerfCounters::enable();
+        } else {
+            std::cout << "Unknown option " << args[1] << std::endl;
+            return 1;
+        }
+        argc--;
+        args++;
+    }
+
     std::cout << "ObjectBox TS demo using ObjectBox library " << obx_version_string()
               << " (core: " << obx_version_core_string() << ")" << std::endl;
 
@@ -65,54 +125,145 @@ int main(int argc, char* args[]) {
     obx::Box<SensorValues> boxSV(store);
     std::cout << "ObjectBox store opened" << std::endl;
 
+    if (argc >= 3 && strcmp(args[1], "export") == 0) {
+        // objectbox_ts_demo export <file> [<begin> <end>] (times in millis since epoch; default: all)
+        // The file extension selects the format: .jsonl/.ndjson (JSON lines), .json (array), .csv or columnar (other)
+        int64_t begin = argc >= 5 ? atoll(args[3]) : std::numeric_limits<int64_t>::min();
+        int64_t end = argc >= 5 ? atoll(args[4]) : std::numeric_limits<int64_t>::max();
+        StopWatch stopWatch;
+        TextFormat textFormat;
+        if (textFormatForPath(args[2], textFormat)) {  // .jsonl, .ndjson, .json or .csv
+            uint64_t bytes = 0;
+            uint64_t count = exportSensorValuesText(boxSV, args[2], textFormat, begin, end, &bytes);
+            uint64_t nanos = stopWatch.durationInNanos();
+            double megabytes = static_cast<double>(bytes) / 1e6;
+            std::cout << "Exported " << count << " objects to " << args[2] << " in " << StopWatch::durationForLog(nanos)
+                      << " (" << megabytes << " MB, " << (nanos ? megabytes * 1e9 / nanos : 0) << " MB/s)" << std::endl;
+            return 0;
+        }
+        uint64_t count = exportSensorValues(boxSV, args[2], begin, end);
+        std::cout << "Exported " << count << " objects to " << args[2] << " in " << stopWatch.durationForLog()
+                  << std::endl;
+        return 0;
+    }
+
+    if (argc >= 3 && strcmp(args[1], "import") == 0) {
+        // objectbox_ts_demo import <file>: adds all objects of a columnar file (with new IDs)
+        PerfStopWatch stopWatch;
+        uint64_t count = importSensorValues(store, boxSV, args[2]);
+        uint64_t millis = stopWatch.durationInMillis();
+        std::cout << "Imported " << count << " objects from " << args[2] << " in " << stopWatch.durationForLog()
+                  << " (" << (millis ? count * 1000 / millis : count) << " objects/s)" << std::endl;
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(args[1], "ingest") == 0) {
+        // objectbox_ts_demo ingest [<threads>]: parallel serialization, single writer (default: all hardware threads)
+        unsigned threads = argc >= 3 ? static_cast<unsigned>(atoi(args[2])) : std::thread::hardware_concurrency();
+        int dataCount = 1000000;
+        std::vector<SensorValues> values;
+        {
+            TraceScope scope("createSensorValueData", "objects", dataCount);
+            values = createSensorValueData(millisSinceEpoch(), dataCount);
+        }
+        LatencyHistogram putLatency("put");
+        MemoryPhase phase("put");
+        StopWatch stopWatch;
+        putParallel(store, boxSV, values, threads, &putLatency);
+        uint64_t millis = stopWatch.durationInMillis();
+        std::cout << "Put " << dataCount << " objects using " << threads << " serialization thread(s) in "
+                  << stopWatch.durationForLog() << " (" << (millis ? dataCount * 1000ULL / millis : dataCount)
+                  << " objects/s)" << std::endl;
+        std::cout << putLatency.summary() << std::endl;
+        std::cout << phase.summary() << std::endl;
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(args[1], "migrate") == 0) {
+        // objectbox_ts_demo migrate [remove]: copies all SensorValues to SensorValuesPacked (same IDs)
+        bool remove = argc >= 3 && strcmp(args[2], "remove") == 0;
+        obx::Box<SensorValuesPacked> boxPacked(store);
+        PerfStopWatch stopWatch;
+        uint64_t count = migrateToPacked(store, boxSV, boxPacked, remove);
+        std::cout << "Migrated " << count << " objects to SensorValuesPacked in " << stopWatch.durationForLog()
+                  << (remove ? " (removed the originals)" : "") << std::endl;
+        return 0;
+    }
+
+    // objectbox_ts_demo latency <file>: runs the demo and writes the latency histograms as JSON to the given file
+    const char* latencyJsonPath = argc >= 3 && strcmp(args[1], "latency") == 0 ? args[2] : nullptr;
+    DemoLatencies latencies;
+
     int64_t start = millisSinceEpoch();
     boxNTR.removeAll();
-    removeDataBefore(boxSV, start - 5000);  // Older than 5s
+    std::vector<std::string> memory;  // summary per phase
+    MemoryPhase phase("remove old data");
+    removeDataBefore(boxSV, start - 5000, latencies.remove);  // Older than 5s
     // boxSV.removeAll();  // Or remove all if you prefer consistent data each run
+    memory.push_back(phase.summary());
 
-    // Create some SensorValues dummy data and put it in the database (while measuring the time for put)
+    // Create some SensorValues dummy data and put it in the database (measuring the time)
     int dataCount = 1000000;
-    std::vector<SensorValues> values = createSensorValueData(start, dataCount);
-    StopWatch stopWatch;
-    boxSV.put(values);
+    std::vector<SensorValues> values;
+    {
+        TraceScope scope("createSensorValueData", "objects", dataCount);
+        phase = MemoryPhase("create data");
+        values = createSensorValueData(start, dataCount);
+        memory.push_back(phase.summary());
+    }
+    phase = MemoryPhase("put");
+    PerfStopWatch stopWatch;
+    {
+        TraceScope scope("put", "objects", dataCount);
+        boxSV.put(values);
+    }
+    latencies.put.record(stopWatch.durationInNanos());
     std::cout << "Put " << dataCount << " objects in " << stopWatch.durationForLog() << std::endl;
-    values.clear();  // Free memory for putted objects (optional)
+    memory.push_back(phase.summary());
+
+    // Free memory of the put objects (optional); note: clear() alone would keep the capacity, i.e. the memory
+    phase = MemoryPhase("free data");
+    std::vector<SensorValues>().swap(values);
+    memory.push_back(phase.summary());
 
+    phase = MemoryPhase("named time ranges");
     putAndPrintNamedTimeRanges(boxNTR, start);
+    memory.push_back(phase.summary());
+
+    phase = MemoryPhase("min/max");
+    printMinMaxTime(boxSV, start, latencies.minMax);
+    memory.push_back(phase.summary());
 
-    printMinMaxTime(boxSV, start);
+    phase = MemoryPhase("queries");
+    buildAndRunQueries(boxSV, start, latencies);
+    memory.push_back(phase.summary());
 
-    buildAndRunQueries(boxSV, start);
+    latencies.print();
+    std::cout << "Memory:" << std::endl;
+    for (const std::string& summary : memory) std::cout << "  " << summary << std::endl;
+    if (latencyJsonPath) latencies.writeJson(latencyJsonPath);
 
     return 0;
 }
 
-std::vector<SensorValues> createSensorValueData(int64_t now, int dataCount) {
-    std::vector<SensorValues> values;
-    values.reserve(dataCount);
-    double deltaDelta = 0.000001;
-    double delta = 0.0;
-    double value = 0.0;
-    for (int i = 1; i <= dataCount; ++i) {
-        delta += deltaDelta;
-        value += delta;
-        if ((delta > 0.01 && deltaDelta > 0) || (delta < -0.01 && deltaDelta < 0)) {
-            deltaDelta = -deltaDelta;
-        }
-        if (i % 100000 == 0) std::cout << "index " << i << ": v=" << value << ", delta=" << delta << std::endl;
-
-        SensorValues sensorValues{OBX_ID_NEW,
-                                  now - 1000 + i * 20,
-                                  19.5 + value,
-                                  23.3 + value * cos(value),
-                                  42.75 + value * sin(value),
-                                  0.80 - value,
-                                  0.7 - value,
-                                  0.6 - value,
-                                  0.5 - value};
-        values.emplace_back(sensorValues);
+void DemoLatencies::print() const {
+    std::cout << "Latencies:" << std::endl;
+    for (const LatencyHistogram* histogram : {&put, &remove, &minMax, &timeRangeQuery, &columnsQuery, &linkedQuery}) {
+        std::cout << "  " << histogram->summary() << std::endl;
     }
-    return values;
+}
+
+void DemoLatencies::writeJson(const char* path) const {
+    std::ofstream out(path);
+    out << "[";
+    const char* separator = "";
+    for (const LatencyHistogram* histogram : {&put, &remove, &minMax, &timeRangeQuery, &columnsQuery, &linkedQuery}) {
+        out << separator << "\n  " << histogram->toJson();
+        separator = ",";
+    }
+    out << "\n]\n";
+    if (!out) throw std::runtime_error(std::string("Could not write latencies to ") + path);
+    std::cout << "Wrote latencies to " << path << std::endl;
 }
 
 void putAndPrintNamedTimeRanges(obx::Box<NamedTimeRange>& boxNTR, int64_t start) {
@@ -131,16 +282,25 @@ void putAndPrintNamedTimeRanges(obx::Box<NamedTimeRange>& boxNTR, int64_t start)
     if (object) {
         std::cout << "Read object: " << object->id << ", name: " << object->name << std::endl;
     }
+
+    // Views reference the stored data directly (no copies); they are only valid inside the visitor
+    visitNamedTimeRanges(boxNTR, [](const NamedTimeRangeView& view) {
+        std::cout << "Visited time range " << view.id << ": " << view.name << " (" << view.end - view.begin
+                  << " ms)" << std::endl;
+        return true;
+    });
 }
 
-void printMinMaxTime(obx::Box<SensorValues>& box, int64_t start) {
+void printMinMaxTime(obx::Box<SensorValues>& box, int64_t start, LatencyHistogram& latency) {
+    TraceScope scope("printMinMaxTime");
     std::cout << "Start time: ";
     putTimestamp(start);
 
-    StopWatch stopWatch;
+    PerfStopWatch stopWatch;
     int64_t timeMin{0}, timeMax{0};
     // We could also get the IDs, but we pass nullptr instead as we only print the values
     box.timeSeriesMinMax(nullptr, &timeMin, nullptr, &timeMax);
+    latency.record(stopWatch.durationInNanos());
     std::cout << std::endl << "Min time value in database: ";
     putTimestamp(timeMin);
     std::cout << std::endl << "Max time value in database: ";
@@ -148,16 +308,35 @@ void printMinMaxTime(obx::Box<SensorValues>& box, int64_t start) {
     std::cout << std::endl << "Got min/max in " << stopWatch.durationForLog() << std::endl;
 }
 
-void buildAndRunQueries(obx::Box<SensorValues>& box, int64_t start) {
+void buildAndRunQueries(obx::Box<SensorValues>& box, int64_t start, DemoLatencies& latencies) {
+    TraceScope scope("buildAndRunQueries");
+
     // Query objects in a certain one second time range
     {
         obx::QueryBuilder<SensorValues> qbRange = box.query();
         qbRange.with(SensorValues_::time.between(start + 1000, start + 1999));
         obx::Query<SensorValues> query = qbRange.build();  // Note: query object can be re-used (without its builder)
-        StopWatch stopWatch;
-        std::vector<std::unique_ptr<SensorValues>> result = query.findUniquePtrs();
+        PerfStopWatch stopWatch;
+        std::vector<std::unique_ptr<SensorValues>> result;
+        {
+            TraceScope queryScope("time range query");
+            result = query.findUniquePtrs();
+        }
+        latencies.timeRangeQuery.record(stopWatch.durationInNanos());
         std::cout << "Time range query completed in " << stopWatch.durationForLog() << " (" << result.size()
                   << " resulting objects)" << std::endl;
+
+        // Same query into columns (one vector per property), e.g. for analytics
+        SensorValuesColumns columns;
+        stopWatch.reset();
+        {
+            TraceScope queryScope("columns query");
+            findColumns(query, columns);
+        }
+        latencies.columnsQuery.record(stopWatch.durationInNanos());
+        double sum = 0;
+        for (double value : columns.temperatureOutside) sum += value;
+        std::cout << "Average outside temperature: " << (columns.empty() ? 0 : sum / columns.size()) << std::endl;
     }
 
     // Query objects using a link to a entity type that defines a time range (NamedTimeRange)
@@ -168,18 +347,25 @@ void buildAndRunQueries(obx::Box<SensorValues>& box, int64_t start) {
         qbNamedTimeRange.with(NamedTimeRange_::name.equals("green"));
         obx::Query<SensorValues> query = qbLink.build();  // Note: query object can be re-used (without its builder)
 
-        StopWatch stopWatch;
-        std::vector<std::unique_ptr<SensorValues>> result = query.findUniquePtrs();
+        PerfStopWatch stopWatch;
+        std::vector<std::unique_ptr<SensorValues>> result;
+        {
+            TraceScope queryScope("linked query");
+            result = query.findUniquePtrs();
+        }
+        latencies.linkedQuery.record(stopWatch.durationInNanos());
         std::cout << "Named time range query (linked) completed in " << stopWatch.durationForLog() << " ("
                   << result.size() << " resulting objects)" << std::endl;
     }
 }
 
-void removeDataBefore(obx::Box<SensorValues> box, int64_t time) {
+void removeDataBefore(obx::Box<SensorValues> box, int64_t time, LatencyHistogram& latency) {
+    TraceScope scope("removeDataBefore");
     obx::QueryBuilder<SensorValues> queryBuilder = box.query();
     queryBuilder.with(SensorValues_::time.lessThan(time));
-    StopWatch stopWatch;
+    PerfStopWatch stopWatch;
     size_t removeCount = queryBuilder.build().remove();
+    latency.record(stopWatch.durationInNanos());
     std::cout << "Removed old objects in " << stopWatch.durationForLog() << " (" << removeCount << " objects)"
               << std::endl;
 
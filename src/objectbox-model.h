@@ -45,7 +45,29 @@ static inline OBX_model* create_obx_model() {
     obx_model_property(model, "loadCpu4", OBXPropertyType_Double, 9, 6954854995237423885);
     obx_model_entity_last_property_id(model, 9, 6954854995237423885);
     
-    obx_model_last_entity_id(model, 2, 6576462802871325567);
+    obx_model_entity(model, "SensorValuesQuantized", 3, 8463129011669203702);
+    obx_model_property(model, "id", OBXPropertyType_Long, 1, 6182696899245611168);
+    obx_model_property_flags(model, OBXPropertyFlags_ID);
+    obx_model_property(model, "time", OBXPropertyType_Date, 2, 4088719726196246274);
+    obx_model_property_flags(model, OBXPropertyFlags_ID_COMPANION);
+    obx_model_property(model, "temperatureOutside", OBXPropertyType_Short, 3, 5117647025610242075);
+    obx_model_property(model, "temperatureInside", OBXPropertyType_Double, 4, 1279415246839194963);
+    obx_model_property(model, "temperatureCpu", OBXPropertyType_Double, 5, 8872998728693676161);
+    obx_model_property(model, "loadCpu1", OBXPropertyType_Float, 6, 4501889964656194273);
+    obx_model_property(model, "loadCpu2", OBXPropertyType_Float, 7, 6834640915105659540);
+    obx_model_property(model, "loadCpu3", OBXPropertyType_Float, 8, 5849937880486312074);
+    obx_model_property(model, "loadCpu4", OBXPropertyType_Float, 9, 1682891803755112212);
+    obx_model_entity_last_property_id(model, 9, 1682891803755112212);
+    
+    obx_model_entity(model, "SensorValuesPacked", 4, 7760251838084951520);
+    obx_model_property(model, "id", OBXPropertyType_Long, 1, 4415868208084401978);
+    obx_model_property_flags(model, OBXPropertyFlags_ID | OBXPropertyFlags_ID_SELF_ASSIGNABLE);
+    obx_model_property(model, "time", OBXPropertyType_Date, 2, 8077777558700044208);
+    obx_model_property_flags(model, OBXPropertyFlags_ID_COMPANION);
+    obx_model_property(model, "payload", OBXPropertyType_DoubleVector, 3, 1799878937996995895);
+    obx_model_entity_last_property_id(model, 3, 1799878937996995895);
+    
+    obx_model_last_entity_id(model, 4, 7760251838084951520);
     return model; // NOTE: the returned model will contain error information if an error occurred.
 }
 
@@ -101,3 +101,99 @@ void objectbox::tsdemo::SensorValues::_OBX_MetaInfo::fromFlatBuffer(const void*
     outObject.loadCpu4 = table->GetField<double>(20, 0.0);
 }
 
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Long> objectbox::tsdemo::SensorValuesQuantized_::id(1);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Date> objectbox::tsdemo::SensorValuesQuantized_::time(2);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Short> objectbox::tsdemo::SensorValuesQuantized_::temperatureOutside(3);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Double> objectbox::tsdemo::SensorValuesQuantized_::temperatureInside(4);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Double> objectbox::tsdemo::SensorValuesQuantized_::temperatureCpu(5);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Float> objectbox::tsdemo::SensorValuesQuantized_::loadCpu1(6);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Float> objectbox::tsdemo::SensorValuesQuantized_::loadCpu2(7);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Float> objectbox::tsdemo::SensorValuesQuantized_::loadCpu3(8);
+const obx::Property<objectbox::tsdemo::SensorValuesQuantized, OBXPropertyType_Float> objectbox::tsdemo::SensorValuesQuantized_::loadCpu4(9);
+
+void objectbox::tsdemo::SensorValuesQuantized::_OBX_MetaInfo::toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const objectbox::tsdemo::SensorValuesQuantized& object) {
+    fbb.Clear();
+    flatbuffers::uoffset_t fbStart = fbb.StartTable();
+    fbb.AddElement(4, object.id);
+    fbb.AddElement(6, object.time);
+    fbb.AddElement(8, object.temperatureOutside);
+    fbb.AddElement(10, object.temperatureInside);
+    fbb.AddElement(12, object.temperatureCpu);
+    fbb.AddElement(14, object.loadCpu1);
+    fbb.AddElement(16, object.loadCpu2);
+    fbb.AddElement(18, object.loadCpu3);
+    fbb.AddElement(20, object.loadCpu4);
+    flatbuffers::Offset<flatbuffers::Table> offset;
+    offset.o = fbb.EndTable(fbStart);
+    fbb.Finish(offset);
+}
+
+objectbox::tsdemo::SensorValuesQuantized objectbox::tsdemo::SensorValuesQuantized::_OBX_MetaInfo::fromFlatBuffer(const void* data, size_t size) {
+    objectbox::tsdemo::SensorValuesQuantized object;
+    fromFlatBuffer(data, size, object);
+    return object;
+}
+
+std::unique_ptr<objectbox::tsdemo::SensorValuesQuantized> objectbox::tsdemo::SensorValuesQuantized::_OBX_MetaInfo::newFromFlatBuffer(const void* data, size_t size) {
+    auto object = std::unique_ptr<objectbox::tsdemo::SensorValuesQuantized>(new objectbox::tsdemo::SensorValuesQuantized());
+    fromFlatBuffer(data, size, *object);
+    return object;
+}
+
+void objectbox::tsdemo::SensorValuesQuantized::_OBX_MetaInfo::fromFlatBuffer(const void* data, size_t, objectbox::tsdemo::SensorValuesQuantized& outObject) {
+    const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+    assert(table);
+    outObject.id = table->GetField<obx_id>(4, 0);
+    outObject.time = table->GetField<int64_t>(6, 0);
+    outObject.temperatureOutside = table->GetField<int16_t>(8, 0);
+    outObject.temperatureInside = table->GetField<double>(10, 0.0);
+    outObject.temperatureCpu = table->GetField<double>(12, 0.0);
+    outObject.loadCpu1 = table->GetField<float>(14, 0.0f);
+    outObject.loadCpu2 = table->GetField<float>(16, 0.0f);
+    outObject.loadCpu3 = table->GetField<float>(18, 0.0f);
+    outObject.loadCpu4 = table->GetField<float>(20, 0.0f);
+}
+
+const obx::Property<objectbox::tsdemo::SensorValuesPacked, OBXPropertyType_Long> objectbox::tsdemo::SensorValuesPacked_::id(1);
+const obx::Property<objectbox::tsdemo::SensorValuesPacked, OBXPropertyType_Date> objectbox::tsdemo::SensorValuesPacked_::time(2);
+const obx::Property<objectbox::tsdemo::SensorValuesPacked, OBXPropertyType_DoubleVector> objectbox::tsdemo::SensorValuesPacked_::payload(3);
+
+void objectbox::tsdemo::SensorValuesPacked::_OBX_MetaInfo::toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const objectbox::tsdemo::SensorValuesPacked& object) {
+    fbb.Clear();
+    auto offsetpayload = fbb.CreateVector(object.payload);
+    flatbuffers::uoffset_t fbStart = fbb.StartTable();
+    fbb.AddElement(4, object.id);
+    fbb.AddElement(6, object.time);
+    fbb.AddOffset(8, offsetpayload);
+    flatbuffers::Offset<flatbuffers::Table> offset;
+    offset.o = fbb.EndTable(fbStart);
+    fbb.Finish(offset);
+}
+
+objectbox::tsdemo::SensorValuesPacked objectbox::tsdemo::SensorValuesPacked::_OBX_MetaInfo::fromFlatBuffer(const void* data, size_t size) {
+    objectbox::tsdemo::SensorValuesPacked object;
+    fromFlatBuffer(data, size, object);
+    return object;
+}
+
+std::unique_ptr<objectbox::tsdemo::SensorValuesPacked> objectbox::tsdemo::SensorValuesPacked::_OBX_MetaInfo::newFromFlatBuffer(const void* data, size_t size) {
+    auto object = std::unique_ptr<objectbox::tsdemo::SensorValuesPacked>(new objectbox::tsdemo::SensorValuesPacked());
+    fromFlatBuffer(data, size, *object);
+    return object;
+}
+
+void objectbox::tsdemo::SensorValuesPacked::_OBX_MetaInfo::fromFlatBuffer(const void* data, size_t, objectbox::tsdemo::SensorValuesPacked& outObject) {
+    const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(data);
+    assert(table);
+    outObject.id = table->GetField<obx_id>(4, 0);
+    outObject.time = table->GetField<int64_t>(6, 0);
+    {
+        auto* ptr = table->GetPointer<const flatbuffers::Vector<double>*>(8);
+        if (ptr) {
+            outObject.payload.assign(ptr->begin(), ptr->end());
+        } else {
+            outObject.payload.clear();
+        }
+    }
+}
+
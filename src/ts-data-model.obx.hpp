@@ -98,3 +98,95 @@ struct SensorValues_ {
 }  // namespace tsdemo
 }  // namespace objectbox
 
+
+namespace objectbox {
+namespace tsdemo {
+struct SensorValuesQuantized_;
+
+/// Storage-optimized (lossy) variant of SensorValues; see src/SensorValuesQuantization.h for the codec
+struct SensorValuesQuantized {
+    obx_id id;
+    int64_t time;
+    int16_t temperatureOutside;
+    double temperatureInside;
+    double temperatureCpu;
+    float loadCpu1;
+    float loadCpu2;
+    float loadCpu3;
+    float loadCpu4;
+
+    struct _OBX_MetaInfo {
+        static constexpr obx_schema_id entityId() { return 3; }
+    
+        static void setObjectId(SensorValuesQuantized& object, obx_id newId) { object.id = newId; }
+    
+        /// Write given object to the FlatBufferBuilder
+        static void toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValuesQuantized& object);
+    
+        /// Read an object from a valid FlatBuffer
+        static SensorValuesQuantized fromFlatBuffer(const void* data, size_t size);
+    
+        /// Read an object from a valid FlatBuffer
+        static std::unique_ptr<SensorValuesQuantized> newFromFlatBuffer(const void* data, size_t size);
+    
+        /// Read an object from a valid FlatBuffer
+        static void fromFlatBuffer(const void* data, size_t size, SensorValuesQuantized& outObject);
+    };
+};
+
+struct SensorValuesQuantized_ {
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Long> id;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Date> time;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Short> temperatureOutside;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Double> temperatureInside;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Double> temperatureCpu;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Float> loadCpu1;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Float> loadCpu2;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Float> loadCpu3;
+    static const obx::Property<SensorValuesQuantized, OBXPropertyType_Float> loadCpu4;
+};
+}  // namespace tsdemo
+}  // namespace objectbox
+
+
+namespace objectbox {
+namespace tsdemo {
+struct SensorValuesPacked_;
+
+/// Variant of SensorValues with all doubles in a single vector (in SensorValues property order, from
+/// temperatureOutside to loadCpu4): one vtable lookup per object instead of one per property. ObjectBox properties
+/// cannot be FlatBuffers structs, so this is not an inline fixed-size layout: the vector is referenced by an offset
+/// and has a length prefix, i.e. reading it also takes an indirection and a length check; the values themselves are
+/// at fixed offsets in the vector. See src/SensorValuesPacking.h for the codec and the migration from SensorValues.
+struct SensorValuesPacked {
+    obx_id id;
+    int64_t time;
+    std::vector<double> payload;
+
+    struct _OBX_MetaInfo {
+        static constexpr obx_schema_id entityId() { return 4; }
+    
+        static void setObjectId(SensorValuesPacked& object, obx_id newId) { object.id = newId; }
+    
+        /// Write given object to the FlatBufferBuilder
+        static void toFlatBuffer(flatbuffers::FlatBufferBuilder& fbb, const SensorValuesPacked& object);
+    
+        /// Read an object from a valid FlatBuffer
+        static SensorValuesPacked fromFlatBuffer(const void* data, size_t size);
+    
+        /// Read an object from a valid FlatBuffer
+        static std::unique_ptr<SensorValuesPacked> newFromFlatBuffer(const void* data, size_t size);
+    
+        /// Read an object from a valid FlatBuffer
+        static void fromFlatBuffer(const void* data, size_t size, SensorValuesPacked& outObject);
+    };
+};
+
+struct SensorValuesPacked_ {
+    static const obx::Property<SensorValuesPacked, OBXPropertyType_Long> id;
+    static const obx::Property<SensorValuesPacked, OBXPropertyType_Date> time;
+    static const obx::Property<SensorValuesPacked, OBXPropertyType_DoubleVector> payload;
+};
+}  // namespace tsdemo
+}  // namespace objectbox
+
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ArenaAllocator.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+using namespace objectbox;
+
+namespace {
+
+const size_t kHugePageSize = 2 * 1024 * 1024;
+
+std::atomic<size_t> threadArenaChunkSize(4 * 1024 * 1024);
+std::atomic<bool> threadArenaHugePages(false);
+
+size_t roundUp(size_t size, size_t alignment) { return (size + alignment - 1) / alignment * alignment; }
+
+uint8_t* mapChunk(size_t size, bool hugePages) {
+    void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (hugePages) p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (p == MAP_FAILED) {  // No (reserved) huge pages available, or not requested
+        p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+        if (hugePages) madvise(p, size, MADV_HUGEPAGE);  // Transparent huge pages; just a hint
+#endif
+    }
+    return static_cast<uint8_t*>(p);
+}
+
+}  // namespace
+
+Arena::Arena(size_t chunkSize, bool hugePages)
+    : chunkSize_(roundUp(chunkSize, hugePages ? kHugePageSize : 4096)), hugePages_(hugePages) {}
+
+Arena::~Arena() {
+    for (const Chunk& chunk : chunks_) munmap(chunk.data, chunk.size);
+}
+
+Arena& Arena::forThread() {
+    static thread_local Arena arena(threadArenaChunkSize.load(), threadArenaHugePages.load());
+    return arena;
+}
+
+void Arena::configureThreadArenas(size_t chunkSize, bool hugePages) {
+    threadArenaChunkSize = chunkSize;
+    threadArenaHugePages = hugePages;
+}
+
+void Arena::nextChunk(size_t minSize) {
+    // Reuse following chunks (available after a reset) if large enough; otherwise map a new one
+    for (size_t i = chunks_.empty() ? 0 : chunkIndex_ + 1; i < chunks_.size(); ++i) {
+        if (chunks_[i].size >= minSize) {
+            chunkIndex_ = i;
+            chunkUsed_ = 0;
+            return;
+        }
+    }
+    size_t size = std::max(chunkSize_, roundUp(minSize, hugePages_ ? kHugePageSize : 4096));
+    chunks_.push_back(Chunk{mapChunk(size, hugePages_), size});
+    chunkIndex_ = chunks_.size() - 1;
+    chunkUsed_ = 0;
+}
+
+uint8_t* Arena::allocate(size_t size) {
+    size_t alignedSize = roundUp(size, kAlignment);
+    if (chunks_.empty() || chunkUsed_ + alignedSize > chunks_[chunkIndex_].size) nextChunk(alignedSize);
+    uint8_t* p = chunks_[chunkIndex_].data + chunkUsed_;
+    chunkUsed_ += alignedSize;
+    last_ = p;
+    live_++;
+    allocationCount_++;
+    return p;
+}
+
+void Arena::deallocate(uint8_t* p, size_t) {
+    assert(live_ > 0);
+    if (--live_ == 0) {  // Everything was freed: start over
+        chunkIndex_ = 0;
+        chunkUsed_ = 0;
+        last_ = nullptr;
+    } else if (p == last_) {
+        chunkUsed_ = static_cast<size_t>(p - chunks_[chunkIndex_].data);
+        last_ = nullptr;
+    }
+}
+
+bool Arena::growLast(uint8_t* p, size_t, size_t newSize) {
+    if (p == nullptr || p != last_) return false;
+    size_t offset = static_cast<size_t>(p - chunks_[chunkIndex_].data);
+    size_t alignedSize = roundUp(newSize, kAlignment);
+    if (offset + alignedSize > chunks_[chunkIndex_].size) return false;
+    chunkUsed_ = offset + alignedSize;
+    return true;
+}
+
+uint8_t* ArenaAllocator::reallocate_downward(uint8_t* oldP, size_t oldSize, size_t newSize, size_t inUseBack,
+                                             size_t inUseFront) {
+    if (Arena::forThread().growLast(oldP, oldSize, newSize)) {
+        // The front stays in place; the back moves to the new end (regions may overlap)
+        memmove(oldP + newSize - inUseBack, oldP + oldSize - inUseBack, inUseBack);
+        return oldP;
+    }
+    return flatbuffers::Allocator::reallocate_downward(oldP, oldSize, newSize, inUseBack, inUseFront);
+}
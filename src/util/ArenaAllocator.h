@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_ARENAALLOCATOR_H
+#define OBJECTBOX_ARENAALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "flatbuffers/allocator.h"
+
+namespace objectbox {
+
+/// Bump pointer memory arena made of large chunks, which are requested from the OS (mmap) and kept until destruction.
+/// Freeing the most recent allocation rolls it back; once all allocations are freed, the whole arena is reused.
+/// Not thread-safe: use one arena per thread, e.g. via forThread().
+class Arena {
+    struct Chunk {
+        uint8_t* data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks_;
+    size_t chunkIndex_ = 0;  // current chunk
+    size_t chunkUsed_ = 0;   // bytes used in the current chunk
+    uint8_t* last_ = nullptr;  // most recent allocation (for roll back and growing in place)
+    size_t live_ = 0;
+    size_t chunkSize_;
+    bool hugePages_;
+    uint64_t allocationCount_ = 0;
+
+    void nextChunk(size_t minSize);
+
+public:
+    static const size_t kAlignment = 16;
+
+    /// @param hugePages back chunks with huge pages if possible (Linux; falls back to transparent huge pages/regular)
+    explicit Arena(size_t chunkSize = 4 * 1024 * 1024, bool hugePages = false);
+
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// The arena of the calling thread (created on first use with the settings of configureThreadArenas())
+    static Arena& forThread();
+
+    /// Settings for arenas created by forThread() afterwards
+    static void configureThreadArenas(size_t chunkSize, bool hugePages);
+
+    uint8_t* allocate(size_t size);
+
+    void deallocate(uint8_t* p, size_t size);
+
+    /// Tries to grow the most recent allocation in place
+    /// @returns false if p is not the most recent allocation or the current chunk has not enough space left
+    bool growLast(uint8_t* p, size_t oldSize, size_t newSize);
+
+    /// Number of allocate() calls served
+    uint64_t allocationCount() const { return allocationCount_; }
+
+    /// Number of chunks requested from the OS (the only "real" allocations)
+    size_t chunkCount() const { return chunks_.size(); }
+};
+
+/// FlatBuffers allocator using the calling thread's Arena, i.e. without malloc/new calls in steady state.
+/// Pass it to a FlatBufferBuilder, which must only be used (including its destruction) on a single thread:
+///     ArenaAllocator allocator;
+///     flatbuffers::FlatBufferBuilder fbb(1024, &allocator);
+/// A single (stateless) instance may be shared by builders of all threads.
+class ArenaAllocator : public flatbuffers::Allocator {
+public:
+    uint8_t* allocate(size_t size) override { return Arena::forThread().allocate(size); }
+
+    void deallocate(uint8_t* p, size_t size) override { Arena::forThread().deallocate(p, size); }
+
+    /// Grows in place if possible: then only the data at the back is moved instead of a new allocation and copy
+    uint8_t* reallocate_downward(uint8_t* oldP, size_t oldSize, size_t newSize, size_t inUseBack,
+                                 size_t inUseFront) override;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_ARENAALLOCATOR_H
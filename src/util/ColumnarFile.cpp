@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace objectbox;
+using namespace objectbox::columnar;
+
+namespace {
+
+const uint8_t kZeros[kAlignment] = {};
+
+template <typename T>
+void columnMinMax(const T* values, size_t count, T& outMin, T& outMax) {
+    T min = values[0];
+    T max = values[0];
+    for (size_t i = 1; i < count; ++i) {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+    }
+    outMin = min;
+    outMax = max;
+}
+
+}  // namespace
+
+ColumnarFileWriter::ColumnarFileWriter(const std::string& path, std::vector<ColumnSpec> columns,
+                                       uint32_t blockRowCapacity)
+    : path_(path), columns_(std::move(columns)), blockRowCapacity_(blockRowCapacity) {
+    if (columns_.empty()) throw std::invalid_argument("At least one column is required");
+    if (blockRowCapacity_ == 0) throw std::invalid_argument("Block row capacity must not be zero");
+    for (const ColumnSpec& column : columns_) {
+        if (column.name.size() >= sizeof(ColumnDescriptor::name)) {
+            throw std::invalid_argument("Column name too long: " + column.name);
+        }
+        blockColumns_.emplace_back(blockRowCapacity_);  // all column types use 8 byte values
+    }
+
+    file_ = fopen(path.c_str(), "wb");
+    if (!file_) throw std::runtime_error("Could not create file " + path);
+    setvbuf(file_, nullptr, _IOFBF, 1024 * 1024);
+
+    FileHeader header{};  // written again with final counts by close()
+    write(&header, sizeof(header));
+    for (const ColumnSpec& column : columns_) {
+        ColumnDescriptor descriptor{};
+        strncpy(descriptor.name, column.name.c_str(), sizeof(descriptor.name) - 1);
+        descriptor.type = static_cast<uint32_t>(column.type);
+        descriptor.valueSize = 8;
+        write(&descriptor, sizeof(descriptor));
+    }
+    writePadding();
+}
+
+ColumnarFileWriter::~ColumnarFileWriter() {
+    if (file_) fclose(file_);
+}
+
+void ColumnarFileWriter::write(const void* data, size_t size) {
+    if (fwrite(data, 1, size, file_) != size) throw std::runtime_error("Could not write to file " + path_);
+    position_ += size;
+}
+
+void ColumnarFileWriter::writePadding() {
+    size_t remainder = position_ % kAlignment;
+    if (remainder) write(kZeros, kAlignment - remainder);
+}
+
+void ColumnarFileWriter::flushBlock() {
+    if (blockRows_ == 0) return;
+    std::vector<ColumnBlockInfo> infos(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        ColumnBlockInfo& info = infos[i];
+        info.offset = position_;
+        if (columns_[i].type == ColumnType::Int64) {
+            columnMinMax(column<int64_t>(i), blockRows_, info.min.i, info.max.i);
+        } else {
+            columnMinMax(column<double>(i), blockRows_, info.min.d, info.max.d);
+        }
+        write(blockColumns_[i].data(), blockRows_ * sizeof(uint64_t));
+        writePadding();
+    }
+
+    BlockFooter footer{blockRows_, rowCount_};
+    blockIndex_.push_back(BlockIndexEntry{position_, blockRows_});
+    write(&footer, sizeof(footer));
+    write(infos.data(), infos.size() * sizeof(ColumnBlockInfo));
+    writePadding();
+
+    rowCount_ += blockRows_;
+    blockRows_ = 0;
+}
+
+void ColumnarFileWriter::close() {
+    if (!file_) return;
+    flushBlock();
+
+    FileHeader header{};
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byteOrderMark = kByteOrderMark;
+    header.columnCount = static_cast<uint32_t>(columns_.size());
+    header.blockRowCapacity = blockRowCapacity_;
+    header.rowCount = rowCount_;
+    header.blockCount = blockIndex_.size();
+    header.blockIndexOffset = position_;
+    write(blockIndex_.data(), blockIndex_.size() * sizeof(BlockIndexEntry));
+
+    // Only write the magic once everything else is there, so incomplete files are never valid
+    bool ok = fseek(file_, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file_) == 1;
+    ok = fclose(file_) == 0 && ok;
+    file_ = nullptr;
+    if (!ok) throw std::runtime_error("Could not finish file " + path_);
+}
+
+ColumnarFileReader::ColumnarFileReader(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Could not open file " + path);
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        throw std::runtime_error("Not a columnar file (too small): " + path);
+    }
+    size_ = static_cast<size_t>(fileStat.st_size);
+    void* mapped = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // the mapping stays valid
+    if (mapped == MAP_FAILED) throw std::runtime_error("Could not map file " + path);
+    data_ = static_cast<const uint8_t*>(mapped);
+
+    header_ = reinterpret_cast<const FileHeader*>(data_);
+    columns_ = reinterpret_cast<const ColumnDescriptor*>(header_ + 1);
+    const char* error = nullptr;
+    if (memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0) {
+        error = "Not a columnar file (bad magic)";
+    } else if (header_->version != kVersion) {
+        error = "Unsupported columnar file version";
+    } else if (header_->byteOrderMark != kByteOrderMark) {
+        error = "Columnar file was written with a different byte order";
+    } else if (sizeof(FileHeader) + header_->columnCount * sizeof(ColumnDescriptor) > size_ ||
+               header_->blockIndexOffset > size_ ||
+               header_->blockCount > (size_ - header_->blockIndexOffset) / sizeof(BlockIndexEntry)) {
+        error = "Columnar file is truncated";
+    } else if (header_->blockIndexOffset % alignof(BlockIndexEntry) != 0) {
+        error = "Columnar file has an invalid block index offset";
+    } else {
+        for (size_t column = 0; column < header_->columnCount && !error; ++column) {
+            uint32_t type = columns_[column].type;
+            if (type != static_cast<uint32_t>(ColumnType::Int64) && type != static_cast<uint32_t>(ColumnType::Double)) {
+                error = "Columnar file has an unknown column type";
+            } else if (columns_[column].valueSize != 8) {  // all column types use 8 byte values
+                error = "Columnar file has an invalid column value size";
+            }
+        }
+    }
+    if (!error) {
+        blockIndex_ = reinterpret_cast<const BlockIndexEntry*>(data_ + header_->blockIndexOffset);
+        size_t footerSize = sizeof(BlockFooter) + header_->columnCount * sizeof(ColumnBlockInfo);
+        for (size_t block = 0; block < header_->blockCount && !error; ++block) {
+            uint64_t footerOffset = blockIndex_[block].footerOffset;
+            if (footerOffset % 8 != 0 || footerOffset > size_ || footerSize > size_ - footerOffset) {
+                error = "Columnar file has an invalid block footer offset";
+                break;
+            }
+            uint64_t rows = footer(block).rowCount;
+            for (size_t column = 0; column < header_->columnCount; ++column) {
+                uint64_t offset = columnInfo(block, column).offset;
+                if (offset % kAlignment != 0 || offset > size_ || rows > (size_ - offset) / sizeof(uint64_t)) {
+                    error = "Columnar file has invalid column offsets";
+                    break;
+                }
+            }
+        }
+    }
+    if (error) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+        throw std::runtime_error(std::string(error) + ": " + path);
+    }
+}
+
+ColumnarFileReader::~ColumnarFileReader() { munmap(const_cast<uint8_t*>(data_), size_); }
+
+void ColumnarFileReader::checkColumnType(size_t column, ColumnType type) const {
+    if (column >= columnCount()) throw std::out_of_range("Column index out of range: " + std::to_string(column));
+    if (columns_[column].type != static_cast<uint32_t>(type)) {
+        throw std::invalid_argument(std::string("Column ") + columns_[column].name + " has a different type");
+    }
+}
+
+int ColumnarFileReader::findColumn(const char* name) const {
+    for (size_t i = 0; i < columnCount(); ++i) {
+        if (strncmp(columns_[i].name, name, sizeof(columns_[i].name)) == 0) return static_cast<int>(i);
+    }
+    return -1;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_COLUMNARFILE_H
+#define OBJECTBOX_COLUMNARFILE_H
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace objectbox {
+
+/// Self-describing, memory-mappable columnar file format ("OBXCOL"); all values use the host byte order.
+/// Layout:
+///   FileHeader, ColumnDescriptor[columnCount] (padded to kAlignment)
+///   per block: column data (each column padded to kAlignment), BlockFooter, ColumnBlockInfo[columnCount] (padded)
+///   BlockIndexEntry[blockCount] (FileHeader::blockIndexOffset points here)
+/// Column data of a block is a plain, aligned array, so it can be scanned (e.g. with SIMD) right from the mapping.
+/// ColumnBlockInfo holds min/max per column and block, so readers can skip blocks without touching their data.
+namespace columnar {
+
+const char kMagic[8] = {'O', 'B', 'X', 'C', 'O', 'L', '0', '1'};
+const uint32_t kVersion = 1;
+const uint32_t kByteOrderMark = 0x01020304;
+const uint32_t kAlignment = 64;
+
+enum class ColumnType : uint32_t { Int64 = 1, Double = 2 };
+
+union ScalarValue {
+    int64_t i;
+    double d;
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;  // kByteOrderMark written in the host byte order of the writer
+    uint32_t columnCount;
+    uint32_t blockRowCapacity;  // rows per block; only the last block may have fewer rows
+    uint64_t rowCount;
+    uint64_t blockCount;
+    uint64_t blockIndexOffset;
+    uint8_t reserved[16];
+};
+
+struct ColumnDescriptor {
+    char name[48];  // zero terminated
+    uint32_t type;  // ColumnType
+    uint32_t valueSize;
+    uint64_t reserved;
+};
+
+struct BlockFooter {
+    uint64_t rowCount;
+    uint64_t firstRow;
+};
+
+struct ColumnBlockInfo {
+    uint64_t offset;  // file offset of the column's values in this block
+    ScalarValue min;
+    ScalarValue max;
+    uint64_t reserved;
+};
+
+struct BlockIndexEntry {
+    uint64_t footerOffset;  // file offset of the BlockFooter
+    uint64_t rowCount;
+};
+
+static_assert(sizeof(FileHeader) == 64, "Unexpected FileHeader size");
+static_assert(sizeof(ColumnDescriptor) == 64, "Unexpected ColumnDescriptor size");
+static_assert(sizeof(ColumnBlockInfo) == 32, "Unexpected ColumnBlockInfo size");
+
+}  // namespace columnar
+
+struct ColumnSpec {
+    std::string name;
+    columnar::ColumnType type;
+};
+
+/// Writes a columnar file block by block; only a single block is held in memory.
+/// Usage: for each row, call addRow() and set each column's value at the returned index via column<T>(index).
+class ColumnarFileWriter {
+    std::string path_;
+    FILE* file_ = nullptr;
+    std::vector<ColumnSpec> columns_;
+    std::vector<std::vector<uint64_t>> blockColumns_;  // uint64_t for alignment
+    std::vector<columnar::BlockIndexEntry> blockIndex_;
+    uint32_t blockRowCapacity_;
+    uint32_t blockRows_ = 0;
+    uint64_t rowCount_ = 0;
+    uint64_t position_ = 0;
+
+    void write(const void* data, size_t size);
+    void writePadding();
+    void flushBlock();
+
+public:
+    /// Creates (or overwrites) the file; throws std::runtime_error on I/O errors (like all other methods)
+    ColumnarFileWriter(const std::string& path, std::vector<ColumnSpec> columns, uint32_t blockRowCapacity = 65536);
+
+    /// Closes the file if close() was not called; errors are ignored (call close() to get them)
+    ~ColumnarFileWriter();
+
+    ColumnarFileWriter(const ColumnarFileWriter&) = delete;
+    ColumnarFileWriter& operator=(const ColumnarFileWriter&) = delete;
+
+    /// Starts a new row (writing the current block first if it is full)
+    /// @returns the row index within the current block to be used with column()
+    uint32_t addRow() {
+        if (blockRows_ == blockRowCapacity_) flushBlock();
+        return blockRows_++;
+    }
+
+    /// The current block's values of the given column; T must match the column type (int64_t or double)
+    template <typename T>
+    T* column(size_t index) {
+        assert(index < columns_.size());
+        return reinterpret_cast<T*>(blockColumns_[index].data());
+    }
+
+    /// Writes the remaining rows, the block index and the final header; the file is complete afterwards
+    void close();
+
+    uint64_t rowCount() const { return rowCount_ + blockRows_; }
+};
+
+/// Read-only memory mapping of a columnar file; the file is validated when opened.
+class ColumnarFileReader {
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    const columnar::FileHeader* header_ = nullptr;
+    const columnar::ColumnDescriptor* columns_ = nullptr;
+    const columnar::BlockIndexEntry* blockIndex_ = nullptr;
+
+    const columnar::BlockFooter& footer(size_t block) const {
+        return *reinterpret_cast<const columnar::BlockFooter*>(data_ + blockIndex_[block].footerOffset);
+    }
+
+    /// Throws std::out_of_range or std::invalid_argument if there is no such column or it has a different type
+    void checkColumnType(size_t column, columnar::ColumnType type) const;
+
+    static columnar::ColumnType columnTypeOf(const int64_t*) { return columnar::ColumnType::Int64; }
+    static columnar::ColumnType columnTypeOf(const double*) { return columnar::ColumnType::Double; }
+
+public:
+    /// Maps the given file; throws std::runtime_error if it cannot be mapped or is not a valid columnar file
+    /// (including unknown column types and value sizes, so columnData() never reads outside the mapping)
+    explicit ColumnarFileReader(const std::string& path);
+
+    ~ColumnarFileReader();
+
+    ColumnarFileReader(const ColumnarFileReader&) = delete;
+    ColumnarFileReader& operator=(const ColumnarFileReader&) = delete;
+
+    uint64_t rowCount() const { return header_->rowCount; }
+
+    size_t columnCount() const { return header_->columnCount; }
+
+    const columnar::ColumnDescriptor& column(size_t index) const { return columns_[index]; }
+
+    /// @returns the index of the column with the given name or -1 if there is no such column
+    int findColumn(const char* name) const;
+
+    size_t blockCount() const { return header_->blockCount; }
+
+    uint64_t blockRowCount(size_t block) const { return footer(block).rowCount; }
+
+    /// Index of the first row of the given block within the file
+    uint64_t blockFirstRow(size_t block) const { return footer(block).firstRow; }
+
+    /// Min/max values and data offset of a column in the given block
+    const columnar::ColumnBlockInfo& columnInfo(size_t block, size_t column) const {
+        return reinterpret_cast<const columnar::ColumnBlockInfo*>(&footer(block) + 1)[column];
+    }
+
+    /// Values of a column in the given block (blockRowCount() values); T must match the column type (int64_t or
+    /// double), otherwise std::invalid_argument is thrown
+    template <typename T>
+    const T* columnData(size_t block, size_t column) const {
+        checkColumnType(column, columnTypeOf(static_cast<const T*>(nullptr)));
+        return reinterpret_cast<const T*>(data_ + columnInfo(block, column).offset);
+    }
+
+    const uint8_t* data() const { return data_; }
+
+    size_t size() const { return size_; }
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_COLUMNARFILE_H
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompiledReflection.h"
+
+#include <stdexcept>
+
+using namespace objectbox;
+
+namespace {
+
+template <typename T>
+double readDouble(const flatbuffers::Table& table, flatbuffers::voffset_t offset, double defaultValue) {
+    const uint8_t* p = table.GetAddressOf(offset);
+    return p ? static_cast<double>(flatbuffers::ReadScalar<T>(p)) : defaultValue;
+}
+
+template <typename T>
+int64_t readInt(const flatbuffers::Table& table, flatbuffers::voffset_t offset, int64_t defaultValue) {
+    const uint8_t* p = table.GetAddressOf(offset);
+    return p ? static_cast<int64_t>(flatbuffers::ReadScalar<T>(p)) : defaultValue;
+}
+
+template <typename T, typename OutT>
+void extract(const OBX_bytes* objects, size_t count, flatbuffers::voffset_t offset, OutT defaultValue, OutT* out) {
+    for (size_t i = 0; i < count; ++i) {
+        const auto* table = flatbuffers::GetRoot<flatbuffers::Table>(objects[i].data);
+        const uint8_t* p = table->GetAddressOf(offset);
+        out[i] = p ? static_cast<OutT>(flatbuffers::ReadScalar<T>(p)) : defaultValue;
+    }
+}
+
+/// Calls the given function object with a (typed) null pointer of the C++ type of the given scalar type
+template <typename Fn>
+void dispatchScalar(reflection::BaseType type, Fn fn) {
+    switch (type) {
+        case reflection::UType:
+        case reflection::Bool:
+        case reflection::UByte: fn(static_cast<uint8_t*>(nullptr)); break;
+        case reflection::Byte: fn(static_cast<int8_t*>(nullptr)); break;
+        case reflection::Short: fn(static_cast<int16_t*>(nullptr)); break;
+        case reflection::UShort: fn(static_cast<uint16_t*>(nullptr)); break;
+        case reflection::Int: fn(static_cast<int32_t*>(nullptr)); break;
+        case reflection::UInt: fn(static_cast<uint32_t*>(nullptr)); break;
+        case reflection::Long: fn(static_cast<int64_t*>(nullptr)); break;
+        case reflection::ULong: fn(static_cast<uint64_t*>(nullptr)); break;
+        case reflection::Float: fn(static_cast<float*>(nullptr)); break;
+        case reflection::Double: fn(static_cast<double*>(nullptr)); break;
+        default: throw std::invalid_argument("Not a scalar type");
+    }
+}
+
+struct ReaderSelector {
+    CompiledField::DoubleReader& readDouble;
+    CompiledField::IntReader& readInt;
+
+    template <typename T>
+    void operator()(T*) const {
+        readDouble = &::readDouble<T>;
+        readInt = &::readInt<T>;
+    }
+};
+
+template <typename OutT>
+struct Extractor {
+    const OBX_bytes* objects;
+    size_t count;
+    flatbuffers::voffset_t offset;
+    OutT defaultValue;
+    OutT* out;
+
+    template <typename T>
+    void operator()(T*) const {
+        extract<T>(objects, count, offset, defaultValue, out);
+    }
+};
+
+}  // namespace
+
+CompiledField::CompiledField(const reflection::Field& field)
+    : name_(field.name()->str()),
+      type_(field.type()->base_type()),
+      offset_(field.offset()),
+      readDouble_(nullptr),
+      readInt_(nullptr) {
+    if (!flatbuffers::IsScalar(type_)) throw std::invalid_argument("Field " + name_ + " is not a scalar");
+    // Defaults are stored as default_integer or default_real depending on the type
+    bool isFloat = flatbuffers::IsFloat(type_);
+    defaultDouble_ = isFloat ? field.default_real() : static_cast<double>(field.default_integer());
+    defaultInt_ = isFloat ? static_cast<int64_t>(field.default_real()) : field.default_integer();
+    dispatchScalar(type_, ReaderSelector{readDouble_, readInt_});
+}
+
+void CompiledField::extractDoubles(const OBX_bytes* objects, size_t count, double* out) const {
+    dispatchScalar(type_, Extractor<double>{objects, count, offset_, defaultDouble_, out});
+}
+
+void CompiledField::extractInts(const OBX_bytes* objects, size_t count, int64_t* out) const {
+    dispatchScalar(type_, Extractor<int64_t>{objects, count, offset_, defaultInt_, out});
+}
+
+CompiledObject::CompiledObject(const reflection::Object& object) : name_(object.name()->str()) {
+    for (const reflection::Field* field : *object.fields()) {
+        if (flatbuffers::IsScalar(field->type()->base_type())) fields_.emplace_back(*field);
+    }
+}
+
+const CompiledField* CompiledObject::field(const char* name) const {
+    for (const CompiledField& field : fields_) {
+        if (field.name() == name) return &field;
+    }
+    return nullptr;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_COMPILEDREFLECTION_H
+#define OBJECTBOX_COMPILEDREFLECTION_H
+
+#include <string>
+#include <vector>
+
+#include "flatbuffers/reflection.h"
+#include "objectbox.h"
+
+namespace objectbox {
+
+/// A scalar reflection::Field "compiled" into an accessor: the vtable offset, the default value and readers
+/// specialized for the field type are resolved once, instead of per call like flatbuffers::GetAnyFieldF() does.
+/// Intended for schema-agnostic tools scanning many objects, e.g. to extract columns of any entity.
+class CompiledField {
+public:
+    typedef double (*DoubleReader)(const flatbuffers::Table& table, flatbuffers::voffset_t offset, double defaultValue);
+    typedef int64_t (*IntReader)(const flatbuffers::Table& table, flatbuffers::voffset_t offset, int64_t defaultValue);
+
+private:
+    std::string name_;
+    reflection::BaseType type_;
+    flatbuffers::voffset_t offset_;
+    double defaultDouble_;
+    int64_t defaultInt_;
+    DoubleReader readDouble_;
+    IntReader readInt_;
+
+public:
+    /// Throws std::invalid_argument if the field is not a scalar
+    explicit CompiledField(const reflection::Field& field);
+
+    const std::string& name() const { return name_; }
+
+    reflection::BaseType type() const { return type_; }
+
+    /// Offset in the vtable (identifies the field within tables)
+    flatbuffers::voffset_t offset() const { return offset_; }
+
+    /// The field value converted to double (or the field's default if not present)
+    double getDouble(const flatbuffers::Table& table) const { return readDouble_(table, offset_, defaultDouble_); }
+
+    /// The field value converted to int64_t (or the field's default if not present)
+    int64_t getInt(const flatbuffers::Table& table) const { return readInt_(table, offset_, defaultInt_); }
+
+    /// Extracts the field of many objects (FlatBuffers with the table as root) into out (count values).
+    /// The type is dispatched once per call; the loop itself is specialized for the field type.
+    void extractDoubles(const OBX_bytes* objects, size_t count, double* out) const;
+
+    /// Like extractDoubles() for integer values (floating point values are truncated)
+    void extractInts(const OBX_bytes* objects, size_t count, int64_t* out) const;
+};
+
+/// The scalar fields of a reflection::Object (e.g. an entity), compiled once
+class CompiledObject {
+    std::string name_;
+    std::vector<CompiledField> fields_;
+
+public:
+    /// Non-scalar fields (e.g. strings) are skipped
+    explicit CompiledObject(const reflection::Object& object);
+
+    const std::string& name() const { return name_; }
+
+    const std::vector<CompiledField>& fields() const { return fields_; }
+
+    /// @returns nullptr if there is no scalar field with the given name
+    const CompiledField* field(const char* name) const;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_COMPILEDREFLECTION_H
@@ -0,0 +1,423 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FastNumbers.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Clinger's fast path needs double arithmetic rounded to double precision (not e.g. x87 extended precision on i386,
+// which would round twice)
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define OBX_FAST_NUMBERS_CLINGER 1
+#else
+#define OBX_FAST_NUMBERS_CLINGER 0
+#endif
+
+// The exact paths use 128 bit integers (GCC/Clang on 64 bit targets, e.g. x86-64 and AArch64; not MSVC)
+#ifdef __SIZEOF_INT128__
+#define OBX_FAST_NUMBERS_INT128 1
+#else
+#define OBX_FAST_NUMBERS_INT128 0
+#endif
+
+using namespace objectbox;
+
+namespace {
+
+const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+const uint64_t kPow10Int[] = {1ULL,
+                              10ULL,
+                              100ULL,
+                              1000ULL,
+                              10000ULL,
+                              100000ULL,
+                              1000000ULL,
+                              10000000ULL,
+                              100000000ULL,
+                              1000000000ULL,
+                              10000000000ULL,
+                              100000000000ULL,
+                              1000000000000ULL,
+                              10000000000000ULL,
+                              100000000000000ULL,
+                              1000000000000000ULL,
+                              10000000000000000ULL,
+                              100000000000000000ULL,
+                              1000000000000000000ULL};
+
+#if OBX_FAST_NUMBERS_INT128
+typedef unsigned __int128 uint128;
+
+/// 5^0 .. 5^27 (5^27 < 2^63), i.e. exact multiplication with 10^n is possible for n <= kMaxPow5
+const uint64_t kPow5[] = {1ULL,
+                          5ULL,
+                          25ULL,
+                          125ULL,
+                          625ULL,
+                          3125ULL,
+                          15625ULL,
+                          78125ULL,
+                          390625ULL,
+                          1953125ULL,
+                          9765625ULL,
+                          48828125ULL,
+                          244140625ULL,
+                          1220703125ULL,
+                          6103515625ULL,
+                          30517578125ULL,
+                          152587890625ULL,
+                          762939453125ULL,
+                          3814697265625ULL,
+                          19073486328125ULL,
+                          95367431640625ULL,
+                          476837158203125ULL,
+                          2384185791015625ULL,
+                          11920928955078125ULL,
+                          59604644775390625ULL,
+                          298023223876953125ULL,
+                          1490116119384765625ULL,
+                          7450580596923828125ULL};
+const int kMaxPow5 = 27;
+
+/// Number of significant bits, e.g. 1 for 1
+int bitLength(uint128 value) {
+    uint64_t high = static_cast<uint64_t>(value >> 64);
+    uint64_t low = static_cast<uint64_t>(value);
+    return high ? 128 - __builtin_clzll(high) : (low ? 64 - __builtin_clzll(low) : 0);
+}
+
+/// value * 2^exp2 rounded to the nearest double (ties to even); sticky tells that the exact value is slightly above
+/// value (i.e. value was truncated), which requires value >= 2^53. The result must be in the normal double range.
+double roundToDouble(uint128 value, bool sticky, int exp2) {
+    int shift = bitLength(value) - 53;
+    if (shift <= 0) return std::ldexp(static_cast<double>(static_cast<uint64_t>(value)), exp2);  // exact
+    uint64_t top = static_cast<uint64_t>(value >> shift);
+    uint128 rest = value & ((uint128(1) << shift) - 1);
+    uint128 half = uint128(1) << (shift - 1);
+    if (rest > half || (rest == half && (sticky || (top & 1)))) {
+        if (++top == (1ULL << 53)) {
+            top >>= 1;
+            shift++;
+        }
+    }
+    return std::ldexp(static_cast<double>(top), exp2 + shift);
+}
+#endif
+
+/// mantissa * 10^exp10 correctly rounded to double, if it can be computed with a single rounding
+bool decimalToDouble(uint64_t mantissa, int64_t exp10, double* out) {
+    if (mantissa == 0) {
+        *out = 0;
+        return true;
+    }
+#if OBX_FAST_NUMBERS_CLINGER
+    // Clinger's fast path: both operands are exact doubles, so the result is rounded once
+    if (mantissa <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22) {
+        double m = static_cast<double>(mantissa);
+        *out = exp10 < 0 ? m / kPow10[-exp10] : m * kPow10[exp10];
+        return true;
+    }
+#endif
+#if OBX_FAST_NUMBERS_INT128
+    // Exact integer arithmetic with 10^n = 5^n * 2^n, rounded once at the end
+    if (exp10 >= 0 && exp10 <= kMaxPow5) {
+        *out = roundToDouble(uint128(mantissa) * kPow5[exp10], false, static_cast<int>(exp10));  // < 2^127
+        return true;
+    }
+    if (exp10 < 0 && -exp10 <= kMaxPow5) {
+        // Shift the mantissa to the top, so the quotient has at least 65 bits (5^27 < 2^63); the remainder is sticky
+        int shift = 128 - bitLength(mantissa);
+        uint128 numerator = uint128(mantissa) << shift;
+        uint64_t divisor = kPow5[-exp10];
+        *out = roundToDouble(numerator / divisor, numerator % divisor != 0, static_cast<int>(exp10) - shift);
+        return true;
+    }
+#endif
+    return false;
+}
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+const char* parseDoubleFallback(const char* begin, const char* end, double* out) {
+    char buffer[64];
+    std::string longText;
+    size_t length = static_cast<size_t>(end - begin);
+    const char* text;
+    if (length < sizeof(buffer)) {
+        memcpy(buffer, begin, length);
+        buffer[length] = 0;
+        text = buffer;
+    } else {
+        longText.assign(begin, end);
+        text = longText.c_str();
+    }
+    char* parsedEnd = nullptr;
+    double value = strtod(text, &parsedEnd);
+    if (parsedEnd == text) return nullptr;
+    *out = value;
+    return begin + (parsedEnd - text);
+}
+
+/// Fallback and reference formatting (also used by formatDouble() if the fast path cannot decide)
+size_t formatDoubleSnprintf(double value, char* out) {
+    char text[kMaxDoubleLength];
+    int length = 0;
+    for (int precision = 15; precision <= 17; ++precision) {
+        length = snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (precision == 17 || strtod(text, nullptr) == value) break;
+    }
+    memcpy(out, text, static_cast<size_t>(length));
+    return static_cast<size_t>(length);
+}
+
+#if OBX_FAST_NUMBERS_INT128
+/// Rounds value (> 0) to the given number of significant digits: value ≈ outMantissa * 10^(outExp10 - digits + 1)
+/// with outMantissa having exactly digits digits. Exact: value * 10^scale is computed as a fraction of 128 bit
+/// integers. Returns false if out of range or on an exact tie (left to snprintf, which rounds ties like the platform).
+bool roundToDigits(double value, int digits, int exp10, uint64_t* outMantissa, int* outExp10) {
+    int exp2;
+    uint64_t significand = static_cast<uint64_t>(std::ldexp(std::frexp(value, &exp2), 53));  // value = s * 2^exp2
+    exp2 -= 53;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        int scale = digits - 1 - exp10;
+        if (scale < -kMaxPow5 || scale > kMaxPow5) return false;
+        uint128 numerator = significand;
+        uint128 denominator = 1;
+        if (scale >= 0) {
+            numerator *= kPow5[scale];
+        } else {
+            denominator = kPow5[-scale];
+        }
+        int shift = exp2 + scale;  // the remaining factor 2^shift of 10^scale * 2^exp2
+        if (shift >= 0) {
+            if (shift > 127 - bitLength(numerator)) return false;
+            numerator <<= shift;
+        } else {
+            if (-shift > 127 - bitLength(denominator)) return false;
+            denominator <<= -shift;
+        }
+        uint128 integer = numerator / denominator;
+        if (integer >= kPow10Int[digits]) {  // exp10 estimate too low
+            exp10++;
+            continue;
+        }
+        if (integer < kPow10Int[digits - 1]) {  // exp10 estimate too high
+            exp10--;
+            continue;
+        }
+        uint128 twiceRest = (numerator % denominator) * 2;  // < 2^128 as denominator < 2^127
+        if (twiceRest == denominator) return false;
+        uint64_t mantissa = static_cast<uint64_t>(integer) + (twiceRest > denominator);
+        if (mantissa == kPow10Int[digits]) {  // rounded up to the next power of ten
+            mantissa = kPow10Int[digits - 1];
+            exp10++;
+        }
+        *outMantissa = mantissa;
+        *outExp10 = exp10;
+        return true;
+    }
+    return false;
+}
+#endif
+
+/// Writes the digits of mantissa (exactly precision digits) with decimal exponent exp10 like printf "%.<precision>g"
+size_t writeLikePrintfG(bool negative, uint64_t mantissa, int precision, int exp10, char* out) {
+    char digits[20];
+    for (int i = precision - 1; i >= 0; --i) {
+        digits[i] = static_cast<char>('0' + mantissa % 10);
+        mantissa /= 10;
+    }
+    int significant = precision;  // %g removes trailing zeros
+    while (significant > 1 && digits[significant - 1] == '0') significant--;
+
+    char* p = out;
+    if (negative) *p++ = '-';
+    if (exp10 < -4 || exp10 >= precision) {  // scientific: d.ddde+XX
+        *p++ = digits[0];
+        if (significant > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, static_cast<size_t>(significant - 1));
+            p += significant - 1;
+        }
+        *p++ = 'e';
+        *p++ = exp10 < 0 ? '-' : '+';
+        unsigned exponent = static_cast<unsigned>(exp10 < 0 ? -exp10 : exp10);
+        if (exponent >= 100) *p++ = static_cast<char>('0' + exponent / 100);
+        *p++ = static_cast<char>('0' + exponent / 10 % 10);
+        *p++ = static_cast<char>('0' + exponent % 10);
+    } else if (exp10 < 0) {  // 0.000ddd
+        *p++ = '0';
+        *p++ = '.';
+        for (int i = -1; i > exp10; --i) *p++ = '0';
+        memcpy(p, digits, static_cast<size_t>(significant));
+        p += significant;
+    } else {  // ddd.ddd (exp10 < precision, so all integer digits are available)
+        int integerDigits = exp10 + 1;
+        memcpy(p, digits, static_cast<size_t>(integerDigits));
+        p += integerDigits;
+        if (significant > integerDigits) {
+            *p++ = '.';
+            memcpy(p, digits + integerDigits, static_cast<size_t>(significant - integerDigits));
+            p += significant - integerDigits;
+        }
+    }
+    return static_cast<size_t>(p - out);
+}
+
+/// The fast path of parseDouble(): nullptr if the number is left to strtod (or there is no number at begin)
+const char* parseDoubleFast(const char* begin, const char* end, double* out) {
+    const char* p = begin;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+
+    uint64_t mantissa = 0;
+    int significantDigits = 0;
+    int64_t exp10 = 0;
+    bool anyDigits = false;
+    bool truncated = false;  // more than 19 significant digits
+    for (; p != end && isDigit(*p); ++p) {
+        anyDigits = true;
+        if (significantDigits < 19) {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+            if (mantissa) significantDigits++;
+        } else {
+            truncated |= *p != '0';
+            exp10++;
+        }
+    }
+    if (p != end && *p == '.') {
+        for (++p; p != end && isDigit(*p); ++p) {
+            anyDigits = true;
+            if (significantDigits < 19) {
+                mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+                if (mantissa) significantDigits++;
+                exp10--;
+            } else {
+                truncated |= *p != '0';
+            }
+        }
+    }
+    if (!anyDigits) return nullptr;  // e.g. inf, nan (or no number)
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char* e = p + 1;
+        bool negativeExponent = false;
+        if (e != end && (*e == '-' || *e == '+')) negativeExponent = *e++ == '-';
+        if (e != end && isDigit(*e)) {  // otherwise the number ends before the 'e' (like strtod)
+            int64_t exponent = 0;
+            for (; e != end && isDigit(*e); ++e) {
+                if (exponent < 100000) exponent = exponent * 10 + (*e - '0');
+            }
+            exp10 += negativeExponent ? -exponent : exponent;
+            p = e;
+        }
+    }
+    // Hexadecimal floats ("0x...") are left to strtod as well
+    if (truncated || (p != end && (*p == 'x' || *p == 'X'))) return nullptr;
+
+    double value;
+    if (!decimalToDouble(mantissa, exp10, &value)) return nullptr;
+    *out = negative ? -value : value;
+    return p;
+}
+
+/// The fast path of formatDouble(): the number of characters written or 0 if the value is left to snprintf
+size_t formatDoubleFast(double value, char* out) {
+    if (!std::isfinite(value)) {
+        const char* text = std::isnan(value) ? "nan" : (value > 0 ? "inf" : "-inf");
+        size_t length = strlen(text);
+        memcpy(out, text, length);
+        return length;
+    }
+    bool negative = std::signbit(value);
+    double magnitude = std::fabs(value);
+    if (magnitude == 0) return writeLikePrintfG(negative, 0, 1, 0, out);
+#if OBX_FAST_NUMBERS_INT128
+    int exp10 = static_cast<int>(std::floor(std::log10(magnitude)));  // may be off by one; corrected by rounding
+    for (int precision = 15; precision <= 17; ++precision) {
+        uint64_t mantissa;
+        int mantissaExp10;
+        if (!roundToDigits(magnitude, precision, exp10, &mantissa, &mantissaExp10)) break;
+        double parsed;
+        bool exact = precision == 17;  // 17 significant digits always round-trip
+        if (!exact) {
+            if (!decimalToDouble(mantissa, mantissaExp10 - precision + 1, &parsed)) break;
+            exact = parsed == magnitude;
+        }
+        if (exact) return writeLikePrintfG(negative, mantissa, precision, mantissaExp10, out);
+    }
+#endif
+    return 0;
+}
+
+}  // namespace
+
+const char* objectbox::parseDouble(const char* begin, const char* end, double* out) {
+    const char* parsedEnd = parseDoubleFast(begin, end, out);
+    return parsedEnd ? parsedEnd : parseDoubleFallback(begin, end, out);
+}
+
+bool objectbox::parseDoubleIsFast(const char* begin, const char* end) {
+    double value;
+    return parseDoubleFast(begin, end, &value) != nullptr;
+}
+
+const char* objectbox::parseInt64(const char* begin, const char* end, int64_t* out) {
+    const char* p = begin;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+    const char* digitsBegin = p;
+    uint64_t value = 0;
+    uint64_t limit = negative ? uint64_t(INT64_MAX) + 1 : uint64_t(INT64_MAX);
+    for (; p != end && isDigit(*p); ++p) {
+        unsigned digit = static_cast<unsigned>(*p - '0');
+        if (value > (limit - digit) / 10) return nullptr;  // out of range
+        value = value * 10 + digit;
+    }
+    if (p == digitsBegin) return nullptr;
+    *out = negative ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
+    return p;
+}
+
+bool objectbox::stringToDouble(const char* str, double* out) {
+    const char* end = str + strlen(str);
+    double value;
+    const char* parsedEnd = parseDouble(str, end, &value);
+    if (parsedEnd != end || parsedEnd == str) return false;
+    *out = value;
+    return true;
+}
+
+size_t objectbox::formatDouble(double value, char* out) {
+    size_t length = formatDoubleFast(value, out);
+    return length ? length : formatDoubleSnprintf(value, out);
+}
+
+bool objectbox::formatDoubleIsFast(double value) {
+    char text[kMaxDoubleLength];
+    return formatDoubleFast(value, text) != 0;
+}
+
+std::string objectbox::doubleToString(double value) {
+    char text[kMaxDoubleLength];
+    return std::string(text, formatDouble(value, text));
+}
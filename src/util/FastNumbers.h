@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_FASTNUMBERS_H
+#define OBJECTBOX_FASTNUMBERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace objectbox {
+
+// Fast conversions between numbers and text for bulk text I/O (CSV/JSON), counterparts of flatbuffers::StringToNumber()
+// and flatbuffers::FloatToString() (include/flatbuffers/util.h), which go through strtod/strtoll and stringstream.
+// Results are always exact: common inputs (up to 19 significant digits, decimal exponents within +-27) take fast
+// paths using exact 128 bit integer arithmetic (GCC/Clang on 64 bit targets, e.g. x86-64 and AArch64); all others
+// (and exact ties when formatting) fall back to strtod/snprintf.
+
+/// Parses a decimal floating point number (optional sign, digits, fraction, exponent; also inf/nan via strtod)
+/// from [begin, end); the result is correctly rounded (like strtod).
+/// @returns the end of the parsed number or nullptr if there is no number at begin
+const char* parseDouble(const char* begin, const char* end, double* out);
+
+/// Parses a decimal integer with an optional sign from [begin, end)
+/// @returns the end of the parsed number or nullptr if there is no number at begin or it is out of range
+const char* parseInt64(const char* begin, const char* end, int64_t* out);
+
+/// Like flatbuffers::StringToNumber(): the whole (zero terminated) string must be a number
+bool stringToDouble(const char* str, double* out);
+
+/// Maximum length written by formatDouble()
+const size_t kMaxDoubleLength = 32;
+
+/// Writes the shortest of 15, 16 or 17 significant digits that parses back to the same value, formatted like printf
+/// "%.<digits>g" (i.e. identical to snprintf output); "nan", "inf" or "-inf" if not finite.
+/// @param out at least kMaxDoubleLength bytes; no terminating zero is written
+/// @returns the number of characters written
+size_t formatDouble(double value, char* out);
+
+/// formatDouble() as a string
+std::string doubleToString(double value);
+
+/// Whether parseDouble() takes its fast path for the given number, i.e. does not fall back to strtod
+bool parseDoubleIsFast(const char* begin, const char* end);
+
+/// Whether formatDouble() takes its fast path for the given value, i.e. does not fall back to snprintf
+bool formatDoubleIsFast(double value);
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_FASTNUMBERS_H
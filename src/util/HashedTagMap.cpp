@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HashedTagMap.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace objectbox;
+
+void HashedTagMapBuilder::addString(const std::string& key, const std::string& value) {
+    tags_.push_back(Tag{key, flexbuffers::FBT_STRING, value, 0, 0});
+}
+
+void HashedTagMapBuilder::addInt(const std::string& key, int64_t value) {
+    tags_.push_back(Tag{key, flexbuffers::FBT_INT, std::string(), value, 0});
+}
+
+void HashedTagMapBuilder::addDouble(const std::string& key, double value) {
+    tags_.push_back(Tag{key, flexbuffers::FBT_FLOAT, std::string(), 0, value});
+}
+
+void HashedTagMapBuilder::finish(flexbuffers::Builder& fbb) {
+    // Sort by key like flexbuffers::Builder::EndMap() does, so we know the positions in the map upfront.
+    // Stable sort and keeping the last of equal keys makes the latest value win.
+    std::stable_sort(tags_.begin(), tags_.end(),
+                     [](const Tag& a, const Tag& b) { return strcmp(a.key.c_str(), b.key.c_str()) < 0; });
+    std::vector<Tag> tags;
+    tags.reserve(tags_.size());
+    for (size_t i = 0; i < tags_.size(); ++i) {
+        if (i + 1 < tags_.size() && tags_[i].key == tags_[i + 1].key) continue;
+        tags.push_back(std::move(tags_[i]));
+    }
+    tags_.clear();
+    if (tags.size() > kMaxTags) throw std::length_error("Too many tags: " + std::to_string(tags.size()));
+
+    size_t slotCount = 2;
+    while (slotCount < 2 * tags.size()) slotCount *= 2;
+    slots_.assign(slotCount, 0);
+    for (size_t i = 0; i < tags.size(); ++i) {
+        size_t slot = flatbuffers::HashFnv1a<uint32_t>(tags[i].key.c_str()) & (slotCount - 1);
+        while (slots_[slot] != 0) slot = (slot + 1) & (slotCount - 1);
+        slots_[slot] = static_cast<uint8_t>(i + 1);
+    }
+
+    fbb.Clear();
+    fbb.Vector([&]() {
+        fbb.Map([&]() {
+            for (const Tag& tag : tags) {
+                const char* key = tag.key.c_str();
+                switch (tag.type) {
+                    case flexbuffers::FBT_STRING: fbb.String(key, tag.stringValue); break;
+                    case flexbuffers::FBT_INT: fbb.Int(key, tag.intValue); break;
+                    default: fbb.Double(key, tag.doubleValue); break;
+                }
+            }
+        });
+        fbb.Blob(slots_.data(), slots_.size());
+    });
+    fbb.Finish();
+}
+
+HashedTagMap::HashedTagMap(const uint8_t* buffer, size_t size)
+    : map_(flexbuffers::Map::EmptyMap()), keys_(flexbuffers::TypedVector::EmptyTypedVector()) {
+    flexbuffers::Reference root = flexbuffers::GetRoot(buffer, size);
+    if (root.IsMap()) {
+        map_ = root.AsMap();
+    } else if (root.IsVector()) {
+        flexbuffers::Vector vector = root.AsVector();
+        if (vector.size() == 2 && vector[0].IsMap() && vector[1].IsBlob()) {
+            map_ = vector[0].AsMap();
+            flexbuffers::Blob blob = vector[1].AsBlob();
+            size_t slotCount = blob.size();
+            if (slotCount >= 2 && (slotCount & (slotCount - 1)) == 0) {  // otherwise fall back to binary search
+                keys_ = map_.Keys();
+                slots_ = blob.data();
+                slotMask_ = slotCount - 1;
+            }
+        }
+    }
+}
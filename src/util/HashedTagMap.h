@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_HASHEDTAGMAP_H
+#define OBJECTBOX_HASHEDTAGMAP_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/hash.h"
+
+namespace objectbox {
+
+/// A tag key with its precomputed hash; create it once (e.g. before a scan) and use it for many lookups
+struct TagKey {
+    const char* name;
+    uint32_t hash;
+
+    explicit TagKey(const char* name) : name(name), hash(flatbuffers::HashFnv1a<uint32_t>(name)) {}
+};
+
+/// Builds free-form tags (e.g. location, firmware, unit) as a FlexBuffer with a hash index for O(1) lookups.
+/// The root is a vector [map, index]: a regular FlexBuffers map and a blob with an open addressing hash table
+/// (FNV-1a of the key → 1 + position in the map, 0 for empty slots; at least twice as many slots as tags).
+class HashedTagMapBuilder {
+    struct Tag {
+        std::string key;
+        flexbuffers::Type type;
+        std::string stringValue;
+        int64_t intValue;
+        double doubleValue;
+    };
+
+    std::vector<Tag> tags_;
+    std::vector<uint8_t> slots_;
+
+public:
+    /// Maximum number of tags per map (positions are stored as single bytes)
+    static const size_t kMaxTags = 255;
+
+    void addString(const std::string& key, const std::string& value);
+    void addInt(const std::string& key, int64_t value);
+    void addDouble(const std::string& key, double value);
+
+    /// Writes all tags added since the last finish() as the root of the given (cleared) builder and finishes it.
+    /// If a key was added multiple times, the last value is used. Throws std::length_error for more than kMaxTags.
+    void finish(flexbuffers::Builder& fbb);
+};
+
+/// Reads tags written by HashedTagMapBuilder using the hash index; plain FlexBuffers maps (without an index) are
+/// supported as well and use the binary search of flexbuffers::Map.
+class HashedTagMap {
+    flexbuffers::Map map_;
+    flexbuffers::TypedVector keys_;  // of map_; resolved once
+    const uint8_t* slots_ = nullptr;
+    size_t slotMask_ = 0;
+
+public:
+    HashedTagMap(const uint8_t* buffer, size_t size);
+
+    /// The value for the given key or a null reference (IsNull()) if there is no such tag
+    flexbuffers::Reference operator[](const TagKey& key) const {
+        if (!slots_) return map_[key.name];
+        for (size_t i = key.hash & slotMask_, probes = 0; probes <= slotMask_; i = (i + 1) & slotMask_, ++probes) {
+            size_t slot = slots_[i];
+            if (slot == 0 || slot > keys_.size()) break;
+            if (strcmp(keys_[slot - 1].AsKey(), key.name) == 0) {
+                return static_cast<const flexbuffers::Vector&>(map_)[slot - 1];  // the values
+            }
+        }
+        return flexbuffers::Reference(nullptr, 1, flexbuffers::NullPackedType());
+    }
+
+    const flexbuffers::Map& map() const { return map_; }
+
+    /// Whether the buffer has a hash index (otherwise lookups use binary search)
+    bool indexed() const { return slots_ != nullptr; }
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_HASHEDTAGMAP_H
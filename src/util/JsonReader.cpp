@@ -0,0 +1,262 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "JsonReader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "FastNumbers.h"
+
+using namespace objectbox;
+
+namespace objectbox {
+
+/// Recursive descent parser; nesting is limited so malformed input cannot overflow the stack
+class JsonParser {
+    static const int kMaxDepth = 256;
+
+    const char* begin_;
+    const char* p_;
+    const char* end_;
+
+    [[noreturn]] void fail(const char* message) const {
+        throw std::runtime_error(std::string("Invalid JSON at offset ") + std::to_string(p_ - begin_) + ": " +
+                                 message);
+    }
+
+    void skipWhitespace() {
+        while (p_ < end_ && (*p_ == ' ' || *p_ == '\n' || *p_ == '\r' || *p_ == '\t')) ++p_;
+    }
+
+    bool consume(char c) {
+        skipWhitespace();
+        if (p_ < end_ && *p_ == c) {
+            ++p_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c)) fail((std::string("expected '") + c + "'").c_str());
+    }
+
+    bool consumeLiteral(const char* literal) {
+        size_t length = strlen(literal);
+        if (static_cast<size_t>(end_ - p_) < length || memcmp(p_, literal, length) != 0) return false;
+        p_ += length;
+        return true;
+    }
+
+    uint32_t parseHex4() {
+        if (end_ - p_ < 4) fail("truncated \\u escape");
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = *p_++;
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= static_cast<uint32_t>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<uint32_t>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<uint32_t>(c - 'A' + 10);
+            } else {
+                fail("invalid \\u escape");
+            }
+        }
+        return value;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    std::string parseString() {
+        expect('"');
+        std::string value;
+        while (true) {
+            const char* start = p_;
+            while (p_ < end_ && *p_ != '"' && *p_ != '\\') ++p_;
+            value.append(start, p_);
+            if (p_ == end_) fail("unterminated string");
+            if (*p_++ == '"') return value;
+            if (p_ == end_) fail("unterminated string");
+            char c = *p_++;
+            switch (c) {
+                case '"':
+                case '\\':
+                case '/':
+                    value += c;
+                    break;
+                case 'b':
+                    value += '\b';
+                    break;
+                case 'f':
+                    value += '\f';
+                    break;
+                case 'n':
+                    value += '\n';
+                    break;
+                case 'r':
+                    value += '\r';
+                    break;
+                case 't':
+                    value += '\t';
+                    break;
+                case 'u': {
+                    uint32_t codePoint = parseHex4();
+                    if (codePoint >= 0xD800 && codePoint < 0xDC00 && consumeLiteral("\\u")) {  // surrogate pair
+                        uint32_t low = parseHex4();
+                        if (low < 0xDC00 || low > 0xDFFF) fail("invalid surrogate pair");
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(value, codePoint);
+                    break;
+                }
+                default:
+                    fail("invalid escape");
+            }
+        }
+    }
+
+    void parseValue(JsonValue& value, int depth) {
+        if (depth > kMaxDepth) fail("nested too deeply");
+        skipWhitespace();
+        if (p_ == end_) fail("unexpected end");
+        char c = *p_;
+        if (c == '{') {
+            ++p_;
+            value.type_ = JsonValue::Type::Object;
+            if (consume('}')) return;
+            do {
+                skipWhitespace();
+                std::string name = parseString();
+                expect(':');
+                value.names_.push_back(std::move(name));
+                value.children_.emplace_back(new JsonValue());
+                parseValue(*value.children_.back(), depth + 1);
+            } while (consume(','));
+            expect('}');
+        } else if (c == '[') {
+            ++p_;
+            value.type_ = JsonValue::Type::Array;
+            if (consume(']')) return;
+            do {
+                value.children_.emplace_back(new JsonValue());
+                parseValue(*value.children_.back(), depth + 1);
+            } while (consume(','));
+            expect(']');
+        } else if (c == '"') {
+            value.type_ = JsonValue::Type::String;
+            value.string_ = parseString();
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            const char* numberEnd = parseDouble(p_, end_, &value.number_);
+            if (!numberEnd) fail("invalid number");
+            p_ = numberEnd;
+            value.type_ = JsonValue::Type::Number;
+        } else if (consumeLiteral("true")) {
+            value.type_ = JsonValue::Type::Bool;
+            value.bool_ = true;
+        } else if (consumeLiteral("false")) {
+            value.type_ = JsonValue::Type::Bool;
+        } else if (consumeLiteral("null")) {
+            value.type_ = JsonValue::Type::Null;
+        } else {
+            fail("unexpected character");
+        }
+    }
+
+public:
+    explicit JsonParser(const std::string& json) : begin_(json.data()), p_(begin_), end_(begin_ + json.size()) {}
+
+    JsonValue parseDocument() {
+        JsonValue value;
+        parseValue(value, 0);
+        skipWhitespace();
+        if (p_ != end_) fail("trailing characters");
+        return value;
+    }
+};
+
+}  // namespace objectbox
+
+JsonValue JsonValue::parse(const std::string& json) { return JsonParser(json).parseDocument(); }
+
+JsonValue JsonValue::parseFile(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) throw std::runtime_error("Could not open file " + path);
+    std::string json;
+    char buffer[64 * 1024];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) json.append(buffer, read);
+    bool ok = !ferror(file);
+    fclose(file);
+    if (!ok) throw std::runtime_error("Could not read file " + path);
+    try {
+        return parse(json);
+    } catch (const std::runtime_error& e) {
+        throw std::runtime_error(std::string(e.what()) + " (" + path + ")");
+    }
+}
+
+const JsonValue& JsonValue::at(size_t index) const {
+    static const JsonValue null;
+    return index < children_.size() ? *children_[index] : null;
+}
+
+const std::string& JsonValue::memberName(size_t index) const {
+    static const std::string empty;
+    return index < names_.size() ? names_[index] : empty;
+}
+
+const JsonValue* JsonValue::find(const char* name) const {
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (names_[i] == name) return children_[i].get();
+    }
+    return nullptr;
+}
+
+const JsonValue& JsonValue::operator[](const char* name) const {
+    static const JsonValue null;
+    const JsonValue* value = find(name);
+    return value ? *value : null;
+}
+
+std::vector<double> JsonValue::asNumbers() const {
+    std::vector<double> numbers;
+    if (type_ != Type::Array) return numbers;
+    for (const std::unique_ptr<JsonValue>& element : children_) {
+        if (element->isNumber()) numbers.push_back(element->number_);
+    }
+    return numbers;
+}
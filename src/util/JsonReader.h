@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef OBJECTBOX_JSONREADER_H
+#define OBJECTBOX_JSONREADER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace objectbox {
+
+/// Parsed JSON value (a small DOM) for reading files this project writes itself, e.g. benchmark results.
+/// Objects keep their members in file order; lookups are linear, which is fine for small objects.
+/// Children are owned via unique_ptr (JsonValue is incomplete inside its own definition), so values are move-only.
+class JsonValue {
+public:
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+private:
+    Type type_ = Type::Null;
+    bool bool_ = false;
+    double number_ = 0;
+    std::string string_;
+    std::vector<std::unique_ptr<JsonValue>> children_;  // array elements or object member values
+    std::vector<std::string> names_;                    // object member names (same order as children_)
+
+    friend class JsonParser;
+
+public:
+    JsonValue() = default;
+    JsonValue(JsonValue&&) = default;
+    JsonValue& operator=(JsonValue&&) = default;
+    JsonValue(const JsonValue&) = delete;
+    JsonValue& operator=(const JsonValue&) = delete;
+
+    /// Parses a complete JSON document; throws std::runtime_error with the byte offset on syntax errors
+    static JsonValue parse(const std::string& json);
+
+    /// Reads and parses the given file; throws std::runtime_error if it cannot be read or parsed
+    static JsonValue parseFile(const std::string& path);
+
+    Type type() const { return type_; }
+
+    bool isNull() const { return type_ == Type::Null; }
+
+    bool isNumber() const { return type_ == Type::Number; }
+
+    bool isString() const { return type_ == Type::String; }
+
+    bool isArray() const { return type_ == Type::Array; }
+
+    bool isObject() const { return type_ == Type::Object; }
+
+    /// The value if this is a bool/number/string; otherwise the given default
+    bool asBool(bool defaultValue = false) const { return type_ == Type::Bool ? bool_ : defaultValue; }
+    double asNumber(double defaultValue = 0) const { return type_ == Type::Number ? number_ : defaultValue; }
+    const std::string& asString() const { return string_; }
+
+    /// Number of elements of an array or members of an object (0 for other types)
+    size_t size() const { return children_.size(); }
+
+    /// Element of an array or member value of an object (in file order) at the given index;
+    /// a null value if the index is out of range
+    const JsonValue& at(size_t index) const;
+
+    /// Name of the object member at the given index; an empty string for arrays or if the index is out of range
+    const std::string& memberName(size_t index) const;
+
+    /// The member with the given name or nullptr if there is none (or this is not an object)
+    const JsonValue* find(const char* name) const;
+
+    /// The member with the given name or a null value if there is none
+    const JsonValue& operator[](const char* name) const;
+
+    /// All elements of an array that are numbers
+    std::vector<double> asNumbers() const;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_JSONREADER_H
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+using namespace objectbox;
+
+namespace {
+
+int highestBit(uint64_t value) {
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) bit++;
+    return bit;
+#endif
+}
+
+const double kPercentiles[] = {50, 90, 99, 99.9};
+const char* const kPercentileNames[] = {"p50", "p90", "p99", "p99.9"};
+
+}  // namespace
+
+const int LatencyHistogram::kSubBucketBits;
+const size_t LatencyHistogram::kSubBucketCount;
+const size_t LatencyHistogram::kBucketCount;
+
+LatencyHistogram::LatencyHistogram(std::string name)
+    : name_(std::move(name)), buckets_(new std::atomic<uint64_t>[kBucketCount]) {
+    reset();
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < 2 * kSubBucketCount) return static_cast<size_t>(value);  // exact
+    int shift = highestBit(value) - kSubBucketBits;                      // >= 1
+    size_t top = static_cast<size_t>(value >> shift);                    // [kSubBucketCount, 2 * kSubBucketCount)
+    return kSubBucketCount * (shift + 1) + (top - kSubBucketCount);
+}
+
+uint64_t LatencyHistogram::bucketHighestValue(size_t index) {
+    if (index < 2 * kSubBucketCount) return index;
+    int shift = static_cast<int>(index / kSubBucketCount) - 1;
+    uint64_t top = kSubBucketCount + index % kSubBucketCount;
+    return ((top + 1) << shift) - 1;  // wraps to UINT64_MAX for the very last bucket as intended
+}
+
+void LatencyHistogram::record(uint64_t nanos) {
+    buckets_[bucketIndex(nanos)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(nanos, std::memory_order_relaxed);
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while (nanos < current && !min_.compare_exchange_weak(current, nanos, std::memory_order_relaxed)) {
+    }
+    current = max_.load(std::memory_order_relaxed);
+    while (nanos > current && !max_.compare_exchange_weak(current, nanos, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        uint64_t count = other.buckets_[i].load(std::memory_order_relaxed);
+        if (count) buckets_[i].fetch_add(count, std::memory_order_relaxed);
+    }
+    count_.fetch_add(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    uint64_t otherMin = other.min_.load(std::memory_order_relaxed);
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while (otherMin < current && !min_.compare_exchange_weak(current, otherMin, std::memory_order_relaxed)) {
+    }
+    uint64_t otherMax = other.max_.load(std::memory_order_relaxed);
+    current = max_.load(std::memory_order_relaxed);
+    while (otherMax > current && !max_.compare_exchange_weak(current, otherMax, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (size_t i = 0; i < kBucketCount; ++i) buckets_[i].store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const { return count() ? min_.load(std::memory_order_relaxed) : 0; }
+
+double LatencyHistogram::mean() const {
+    uint64_t count = this->count();
+    return count ? static_cast<double>(sum_.load(std::memory_order_relaxed)) / count : 0;
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const {
+    uint64_t count = this->count();
+    if (count == 0) return 0;
+    // Nearest rank (1-based): the smallest rank with at least the given percentage of samples at or below it;
+    // the factor below 1 keeps rounding errors from bumping exact ranks, e.g. 99.9 % of 1000 to 1000 instead of 999
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percent / 100 * count * (1 - 1e-12)));
+    if (rank < 1) rank = 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) return std::min(bucketHighestValue(i), max());
+    }
+    return max();  // only if samples were recorded concurrently
+}
+
+std::string LatencyHistogram::summary() const {
+    std::string result = name_.empty() ? std::string() : name_ + ": ";
+    result += std::to_string(count()) + " samples";
+    if (count() == 0) return result;
+    result += ", min " + StopWatch::durationForLog(min());
+    for (size_t i = 0; i < sizeof(kPercentiles) / sizeof(kPercentiles[0]); ++i) {
+        result += std::string(", ") + kPercentileNames[i] + " ";
+        result += StopWatch::durationForLog(percentile(kPercentiles[i]));
+    }
+    result += ", max " + StopWatch::durationForLog(max());
+    return result;
+}
+
+std::string LatencyHistogram::toJson() const {
+    // Names are plain identifiers chosen by the code, so they need no escaping
+    std::string json = "{\"name\":\"" + name_ + "\",\"count\":" + std::to_string(count()) +
+                       ",\"min\":" + std::to_string(min());
+    char mean[32];
+    snprintf(mean, sizeof(mean), "%.1f", this->mean());
+    json += std::string(",\"mean\":") + mean;
+    for (size_t i = 0; i < sizeof(kPercentiles) / sizeof(kPercentiles[0]); ++i) {
+        json += std::string(",\"") + kPercentileNames[i] + "\":" + std::to_string(percentile(kPercentiles[i]));
+    }
+    json += ",\"max\":" + std::to_string(max()) + "}";
+    return json;
+}
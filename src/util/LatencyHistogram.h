@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_LATENCYHISTOGRAM_H
+#define OBJECTBOX_LATENCYHISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "StopWatch.h"
+
+namespace objectbox {
+
+/// HDR-style histogram of durations in nanoseconds (e.g. from StopWatch::durationInNanos()) to report percentiles
+/// instead of a single duration. Buckets are log-linear: exact below 256 ns, above that 128 buckets per power of 2,
+/// i.e. reported values are at most 1/128 (< 0.8 %) above the recorded ones; covers the full uint64_t range.
+/// record() is lock-free and may be called from many threads concurrently (bucket counters are atomic);
+/// for high rates, record to one histogram per thread and merge() them afterwards to avoid contention.
+class LatencyHistogram {
+public:
+    static const int kSubBucketBits = 7;
+    static const size_t kSubBucketCount = size_t(1) << kSubBucketBits;
+    static const size_t kBucketCount = kSubBucketCount * (64 - kSubBucketBits + 1);
+
+private:
+    std::string name_;
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_;
+    std::atomic<uint64_t> min_;
+    std::atomic<uint64_t> max_;
+
+    static size_t bucketIndex(uint64_t value);
+
+    /// Largest value that maps to the given bucket
+    static uint64_t bucketHighestValue(size_t index);
+
+public:
+    explicit LatencyHistogram(std::string name = std::string());
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    const std::string& name() const { return name_; }
+
+    void record(uint64_t nanos);
+
+    /// Records the duration since the given StopWatch was started (or reset)
+    void record(const StopWatch& stopWatch) { record(stopWatch.durationInNanos()); }
+
+    /// Adds all samples of the other histogram (e.g. recorded by another thread)
+    void merge(const LatencyHistogram& other);
+
+    void reset();
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    /// 0 if empty
+    uint64_t min() const;
+
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    double mean() const;
+
+    /// The value below or at which the given percentage (0..100) of samples are, e.g. 99.9; 0 if empty.
+    /// Reports the highest value of the bucket (capped by max()).
+    uint64_t percentile(double percent) const;
+
+    /// One line, e.g. "put: 100 samples, p50 1.20 ms, p90 ..., max 3.40 ms"
+    std::string summary() const;
+
+    /// JSON object with name, count, min, mean, p50, p90, p99, p99.9 and max (all in nanoseconds)
+    std::string toJson() const;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_LATENCYHISTOGRAM_H
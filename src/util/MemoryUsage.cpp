@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MemoryUsage.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+using namespace objectbox;
+
+namespace {
+
+std::atomic<uint64_t> totalAllocations(0);
+std::atomic<uint64_t> totalAllocatedBytes(0);
+std::atomic<uint64_t> totalDeallocations(0);
+
+void* countedAllocate(size_t size) {
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    totalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    return malloc(size ? size : 1);  // new must return a unique pointer for size 0
+}
+
+void countedFree(void* p) {
+    if (!p) return;
+    totalDeallocations.fetch_add(1, std::memory_order_relaxed);
+    free(p);
+}
+
+/// Value of a "Name:   1234 kB" line of /proc/self/status in bytes
+uint64_t statusBytes(const char* status, const char* name) {
+    const char* line = strstr(status, name);
+    return line ? strtoull(line + strlen(name), nullptr, 10) * 1024 : 0;
+}
+
+}  // namespace
+
+// Replacements of the global allocation functions (all forms of C++11)
+
+void* operator new(size_t size) {
+    void* p = countedAllocate(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    void* p = countedAllocate(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size); }
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size); }
+
+void operator delete(void* p) noexcept { countedFree(p); }
+
+void operator delete[](void* p) noexcept { countedFree(p); }
+
+void operator delete(void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+
+MemoryUsage MemoryUsage::current() {
+    MemoryUsage usage;
+    usage.allocations = totalAllocations.load(std::memory_order_relaxed);
+    usage.allocatedBytes = totalAllocatedBytes.load(std::memory_order_relaxed);
+    usage.deallocations = totalDeallocations.load(std::memory_order_relaxed);
+
+    // Plain C I/O: streams would allocate (and be counted)
+    char status[4096];
+    FILE* file = fopen("/proc/self/status", "r");
+    if (file) {
+        size_t length = fread(status, 1, sizeof(status) - 1, file);
+        fclose(file);
+        status[length] = '\0';
+        usage.rssBytes = statusBytes(status, "VmRSS:");
+        usage.peakRssBytes = statusBytes(status, "VmHWM:");
+    }
+    return usage;
+}
+
+bool MemoryUsage::resetPeakRss() {
+    FILE* file = fopen("/proc/self/clear_refs", "w");
+    if (!file) return false;
+    bool ok = fputs("5", file) >= 0;
+    return fclose(file) == 0 && ok;
+}
+
+MemoryUsage MemoryUsage::since(const MemoryUsage& earlier) const {
+    MemoryUsage result = *this;
+    result.allocations -= earlier.allocations;
+    result.allocatedBytes -= earlier.allocatedBytes;
+    result.deallocations -= earlier.deallocations;
+    return result;
+}
+
+std::string MemoryUsage::toJson() const {
+    return "{\"rssBytes\":" + std::to_string(rssBytes) + ",\"peakRssBytes\":" + std::to_string(peakRssBytes) +
+           ",\"allocations\":" + std::to_string(allocations) + ",\"allocatedBytes\":" + std::to_string(allocatedBytes) +
+           ",\"deallocations\":" + std::to_string(deallocations) + "}";
+}
+
+std::string MemoryUsage::bytesForLog(uint64_t bytes) {
+    char buffer[32];
+    if (bytes >= 10 * 1024 * 1024) {
+        snprintf(buffer, sizeof(buffer), "%llu MB", static_cast<unsigned long long>((bytes + 512 * 1024) >> 20));
+    } else if (bytes >= 1024 * 1024) {
+        snprintf(buffer, sizeof(buffer), "%.1f MB", static_cast<double>(bytes) / (1024 * 1024));
+    } else if (bytes >= 1024) {
+        snprintf(buffer, sizeof(buffer), "%.1f KB", static_cast<double>(bytes) / 1024);
+    } else {
+        snprintf(buffer, sizeof(buffer), "%llu bytes", static_cast<unsigned long long>(bytes));
+    }
+    return buffer;
+}
+
+MemoryPhase::MemoryPhase(std::string name, bool resetPeak)
+    : name_(std::move(name)), peakReset_(resetPeak && MemoryUsage::resetPeakRss()) {
+    start_ = MemoryUsage::current();
+}
+
+std::string MemoryPhase::summary() const {
+    MemoryUsage usage = this->usage();
+    std::string result = name_ + ": RSS " + MemoryUsage::bytesForLog(usage.rssBytes) + " (";
+    if (usage.rssBytes >= start_.rssBytes) {
+        result += "+" + MemoryUsage::bytesForLog(usage.rssBytes - start_.rssBytes);
+    } else {
+        result += "-" + MemoryUsage::bytesForLog(start_.rssBytes - usage.rssBytes);
+    }
+    result += "), peak " + MemoryUsage::bytesForLog(usage.peakRssBytes) + (peakReset_ ? "" : " (process)");
+    result += ", " + std::to_string(usage.allocations) + " allocations (" +
+              MemoryUsage::bytesForLog(usage.allocatedBytes) + "), " + std::to_string(usage.deallocations) +
+              " deallocations";
+    return result;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_MEMORYUSAGE_H
+#define OBJECTBOX_MEMORYUSAGE_H
+
+#include <cstdint>
+#include <string>
+
+namespace objectbox {
+
+/// Memory use of this process: resident set size from /proc/self/status (Linux) and counts of the global
+/// operator new/delete, which are replaced to count (once this file is linked; using any of its functions does that).
+/// Only allocations via operator new are counted (including those of libraries using the shared C++ runtime),
+/// not direct malloc() calls. Counting uses relaxed atomics shared by all threads.
+struct MemoryUsage {
+    uint64_t rssBytes = 0;        // resident set size (VmRSS); 0 if not available
+    uint64_t peakRssBytes = 0;    // peak resident set size (VmHWM) since start or resetPeakRss()
+    uint64_t allocations = 0;     // operator new calls since start
+    uint64_t allocatedBytes = 0;  // bytes requested by operator new since start
+    uint64_t deallocations = 0;   // operator delete calls (with non-null pointers) since start
+
+    static MemoryUsage current();
+
+    /// Resets the peak RSS to the current RSS (Linux 4.0+, via /proc/self/clear_refs), e.g. to get a phase's peak
+    /// @returns false if not supported
+    static bool resetPeakRss();
+
+    /// Allocation counts since the given earlier usage; RSS values are the current ones
+    MemoryUsage since(const MemoryUsage& earlier) const;
+
+    /// JSON object with all values
+    std::string toJson() const;
+
+    /// Byte count for logs, e.g. "312 MB", "15.2 KB"
+    static std::string bytesForLog(uint64_t bytes);
+};
+
+/// Memory accounting of a phase (e.g. "put"): RSS at the end (and its change), peak RSS and the allocations within
+class MemoryPhase {
+    std::string name_;
+    MemoryUsage start_;
+    bool peakReset_;
+
+public:
+    /// Starts the phase now
+    /// @param resetPeak resets the peak RSS so it reflects this phase only (see MemoryUsage::resetPeakRss())
+    explicit MemoryPhase(std::string name, bool resetPeak = true);
+
+    const std::string& name() const { return name_; }
+
+    /// Usage at the start
+    const MemoryUsage& start() const { return start_; }
+
+    /// Allocations since the start and the current RSS
+    MemoryUsage usage() const { return MemoryUsage::current().since(start_); }
+
+    /// e.g. "put: RSS 410 MB (+120 MB), peak 480 MB, 2003 allocations (45.1 MB), 2000 deallocations"
+    std::string summary() const;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_MEMORYUSAGE_H
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace objectbox;
+
+namespace {
+
+const char* const kCounterNames[] = {"cycles", "instructions", "LLC misses", "branch misses", "page faults"};
+const char* const kCounterJsonNames[] = {"cycles", "instructions", "llcMisses", "branchMisses", "pageFaults"};
+
+/// Compact count for logs, e.g. 1.52G, 12.4M, 980
+std::string formatCount(uint64_t count) {
+    const char* suffixes = " KMGTPE";
+    double value = static_cast<double>(count);
+    int index = 0;
+    while (value >= 1000 && index < 6) {
+        value /= 1000;
+        index++;
+    }
+    char buffer[32];
+    if (index == 0) {
+        snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(count));
+    } else {
+        snprintf(buffer, sizeof(buffer), value < 10 ? "%.2f%c" : value < 100 ? "%.1f%c" : "%.0f%c", value,
+                 suffixes[index]);
+    }
+    return buffer;
+}
+
+#ifdef __linux__
+int openCounter(uint32_t type, uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;  // user space only: allowed with the default perf_event_paranoid level of 2
+    attr.exclude_hv = 1;
+    // Calling thread on any CPU; enabled right away (the group leader controls the siblings)
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+#endif
+
+}  // namespace
+
+double PerfCounterValues::ipc() const {
+    return valid[Cycles] && valid[Instructions] && values[Cycles]
+               ? static_cast<double>(values[Instructions]) / values[Cycles]
+               : 0;
+}
+
+PerfCounterValues PerfCounterValues::operator-(const PerfCounterValues& earlier) const {
+    PerfCounterValues result;
+    for (int i = 0; i < kCount; ++i) {
+        result.valid[i] = valid[i] && earlier.valid[i];
+        // Scaled (multiplexed) values are estimates and may go back slightly
+        result.values[i] = result.valid[i] && values[i] > earlier.values[i] ? values[i] - earlier.values[i] : 0;
+    }
+    return result;
+}
+
+PerfCounterValues& PerfCounterValues::operator+=(const PerfCounterValues& other) {
+    for (int i = 0; i < kCount; ++i) {
+        if (other.valid[i]) {
+            values[i] += other.values[i];
+            valid[i] = true;
+        }
+    }
+    return *this;
+}
+
+std::string PerfCounterValues::toString() const {
+    std::string result;
+    for (int i = 0; i < kCount; ++i) {
+        if (!valid[i]) continue;
+        if (!result.empty()) result += ", ";
+        result += formatCount(values[i]) + " " + kCounterNames[i];
+        if (i == Instructions && ipc() > 0) {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), " (IPC %.2f)", ipc());
+            result += buffer;
+        }
+    }
+    return result;
+}
+
+std::string PerfCounterValues::toJson() const {
+    std::string json = "{";
+    for (int i = 0; i < kCount; ++i) {
+        if (!valid[i]) continue;
+        if (json.size() > 1) json += ",";
+        json += std::string("\"") + kCounterJsonNames[i] + "\":" + std::to_string(values[i]);
+    }
+    return json + "}";
+}
+
+const char* PerfCounterValues::name(Counter counter) { return kCounterNames[counter]; }
+
+std::atomic<bool> PerfCounters::enabled_(false);
+
+PerfCounters::PerfCounters() {
+    for (int i = 0; i < PerfCounterValues::kCount; ++i) {
+        fds_[i] = -1;
+        groupIndex_[i] = -1;
+    }
+#ifdef __linux__
+    const uint32_t types[] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                              PERF_TYPE_SOFTWARE};
+    const uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+                                PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_SW_PAGE_FAULTS};
+    std::vector<std::pair<int, std::string>> failures;  // errno and the names of the counters that failed with it
+    for (int i = 0; i < PerfCounterValues::kCount; ++i) {
+        // The first counter that can be opened leads the group, so all are read at once with a single read()
+        int fd = openCounter(types[i], configs[i], leaderFd_);
+        if (fd < 0) {
+            int error = errno;
+            if (failures.empty() || failures.back().first != error) failures.emplace_back(error, std::string());
+            if (!failures.back().second.empty()) failures.back().second += ", ";
+            failures.back().second += kCounterNames[i];
+            continue;
+        }
+        if (leaderFd_ < 0) leaderFd_ = fd;
+        fds_[i] = fd;
+        groupIndex_[i] = groupSize_++;
+    }
+    for (const std::pair<int, std::string>& failure : failures) {
+        if (!error_.empty()) error_ += "; ";
+        error_ += failure.second + ": " + strerror(failure.first);
+        if (failure.first == EACCES || failure.first == EPERM) error_ += " (see /proc/sys/kernel/perf_event_paranoid)";
+        if (failure.first == ENOENT || failure.first == EOPNOTSUPP) error_ += " (not supported, e.g. in a VM)";
+    }
+#else
+    error_ = "performance counters are only supported on Linux";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+#endif
+}
+
+PerfCounters& PerfCounters::forThread() {
+    static thread_local PerfCounters counters;
+    return counters;
+}
+
+bool PerfCounters::enable() {
+    PerfCounters& counters = forThread();
+    if (!counters.error().empty()) {
+        std::cout << (counters.available() ? "Some performance counters are not available: "
+                                           : "Performance counters are not available: ")
+                  << counters.error() << std::endl;
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+    return counters.available();
+}
+
+PerfCounterValues PerfCounters::read() const {
+    PerfCounterValues result;
+#ifdef __linux__
+    if (leaderFd_ < 0) return result;
+    uint64_t buffer[3 + PerfCounterValues::kCount];  // count, time enabled, time running, values
+    ssize_t size = ::read(leaderFd_, buffer, sizeof(buffer));
+    if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)) || buffer[0] != static_cast<uint64_t>(groupSize_)) {
+        return result;
+    }
+    uint64_t enabled = buffer[1];
+    uint64_t running = buffer[2];
+    if (running == 0) return result;  // never scheduled on the PMU
+    double scale = running < enabled ? static_cast<double>(enabled) / running : 1.0;
+    for (int i = 0; i < PerfCounterValues::kCount; ++i) {
+        if (groupIndex_[i] < 0) continue;
+        uint64_t value = buffer[3 + groupIndex_[i]];
+        result.values[i] = scale == 1.0 ? value : static_cast<uint64_t>(static_cast<double>(value) * scale);
+        result.valid[i] = true;
+    }
+#endif
+    return result;
+}
+
+PerfStopWatch::PerfStopWatch() : counters_(nullptr) { reset(); }
+
+void PerfStopWatch::reset() {
+    if (PerfCounters::enabled() && PerfCounters::forThread().available()) {
+        counters_ = &PerfCounters::forThread();
+        start_ = counters_->read();
+    }
+    stopWatch_.reset();  // last, so the time does not include reading the counters
+}
+
+PerfCounterValues PerfStopWatch::counters() const {
+    return counters_ ? counters_->read() - start_ : PerfCounterValues();
+}
+
+std::string PerfStopWatch::durationForLog() const {
+    std::string result = stopWatch_.durationForLog();
+    if (counters_) {
+        std::string counters = this->counters().toString();
+        if (!counters.empty()) result += " (" + counters + ")";
+    }
+    return result;
+}
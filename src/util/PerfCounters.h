@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_PERFCOUNTERS_H
+#define OBJECTBOX_PERFCOUNTERS_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "StopWatch.h"
+
+namespace objectbox {
+
+/// Hardware and software event counts of a measured region (see PerfCounters)
+struct PerfCounterValues {
+    enum Counter { Cycles, Instructions, CacheMisses, BranchMisses, PageFaults, kCount };
+
+    uint64_t values[kCount] = {};
+    bool valid[kCount] = {};  // false if the counter is not available
+
+    /// Instructions per cycle; 0 if not available
+    double ipc() const;
+
+    /// Difference to an earlier snapshot (counters only valid in both)
+    PerfCounterValues operator-(const PerfCounterValues& earlier) const;
+
+    /// Adds the (valid) values of the other
+    PerfCounterValues& operator+=(const PerfCounterValues& other);
+
+    /// e.g. "1.52G cycles, 2.10G instructions (IPC 1.38), 12.4M LLC misses, 3.21M branch misses, 120 page faults"
+    std::string toString() const;
+
+    /// JSON object with the valid counters, e.g. {"cycles":1520000000,"instructions":2100000000}
+    std::string toJson() const;
+
+    static const char* name(Counter counter);
+};
+
+/// Counter group of the calling thread (cycles, instructions, last level cache misses, branch misses and page faults)
+/// read via Linux perf_event_open() in user space mode; the counters run continuously once opened, so regions are
+/// measured by the difference of two snapshots (see PerfStopWatch) and may nest.
+/// Degrades gracefully: if the kernel forbids access (e.g. perf_event_paranoid, containers, VMs without a PMU),
+/// counters are reported as not available and measuring falls back to time only.
+class PerfCounters {
+    static std::atomic<bool> enabled_;
+
+    int fds_[PerfCounterValues::kCount];
+    int groupIndex_[PerfCounterValues::kCount];  // position in the group read, -1 if not available
+    int leaderFd_ = -1;
+    int groupSize_ = 0;
+    std::string error_;
+
+    PerfCounters();
+
+public:
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /// The counters of the calling thread, opened on first use
+    static PerfCounters& forThread();
+
+    /// Whether PerfStopWatch reads counters (off by default as the first use per thread costs a few system calls)
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Enables counters for PerfStopWatch; prints a notice once if they are not available on this system
+    /// @returns false if no counter is available
+    static bool enable();
+
+    /// Whether at least one counter could be opened
+    bool available() const { return groupSize_ > 0; }
+
+    /// Why counters are not (all) available; empty if all are
+    const std::string& error() const { return error_; }
+
+    /// Current totals of the calling thread since the counters were opened (scaled if the kernel multiplexed them)
+    PerfCounterValues read() const;
+};
+
+/// StopWatch that also measures the performance counters of the calling thread if PerfCounters are enabled;
+/// must be used (read) on the thread that created it.
+class PerfStopWatch {
+    StopWatch stopWatch_;
+    PerfCounters* counters_;
+    PerfCounterValues start_;
+
+public:
+    PerfStopWatch();
+
+    /// Sets the start time and counter values to now
+    void reset();
+
+    uint64_t durationInNanos() const { return stopWatch_.durationInNanos(); }
+
+    uint64_t durationInMillis() const { return stopWatch_.durationInMillis(); }
+
+    /// Whether counters are measured (enabled and at least one available)
+    bool hasCounters() const { return counters_ != nullptr; }
+
+    /// Counter differences since the start; all invalid without counters
+    PerfCounterValues counters() const;
+
+    /// Like StopWatch::durationForLog() with the counters appended if measured, e.g. "5 ms (12.1M cycles, ...)"
+    std::string durationForLog() const;
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_PERFCOUNTERS_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_QUANTIZER_H
+#define OBJECTBOX_QUANTIZER_H
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace objectbox {
+
+/// Lossy mapping of doubles to a signed integer type using a linear scale and offset:
+/// stored = round((value - offset) / scale) and value = stored * scale + offset.
+/// Error bound: for values in [minValue(), maxValue()] the absolute error is at most maxError() (scale / 2).
+/// Values outside of that range are clamped (saturated) to the nearest bound; NaN is stored as 0.
+/// Tip: use a power of 2 for scale (e.g. 1.0 / 128) to make the scaling itself exact.
+template <typename StoredT>
+class LinearQuantizer {
+    static_assert(std::is_integral<StoredT>::value && std::is_signed<StoredT>::value,
+                  "Stored type must be a signed integer type");
+
+    double scale_;
+    double inverseScale_;
+    double offset_;
+
+public:
+    typedef StoredT Stored;
+
+    constexpr explicit LinearQuantizer(double scale, double offset = 0.0)
+        : scale_(scale), inverseScale_(1.0 / scale), offset_(offset) {}
+
+    StoredT encode(double value) const {
+        double scaled = std::round((value - offset_) * inverseScale_);
+        if (scaled != scaled) return 0;  // NaN
+        if (scaled <= std::numeric_limits<StoredT>::min()) return std::numeric_limits<StoredT>::min();
+        if (scaled >= std::numeric_limits<StoredT>::max()) return std::numeric_limits<StoredT>::max();
+        return static_cast<StoredT>(scaled);
+    }
+
+    double decode(StoredT stored) const { return stored * scale_ + offset_; }
+
+    constexpr double scale() const { return scale_; }
+    constexpr double offset() const { return offset_; }
+
+    /// Smallest value that is stored without clamping
+    constexpr double minValue() const { return std::numeric_limits<StoredT>::min() * scale_ + offset_; }
+
+    /// Largest value that is stored without clamping
+    constexpr double maxValue() const { return std::numeric_limits<StoredT>::max() * scale_ + offset_; }
+
+    /// Maximum absolute error for values within [minValue(), maxValue()]
+    constexpr double maxError() const { return scale_ / 2; }
+};
+
+/// Lossy mapping of doubles to 32 bit floats (IEEE 754 round to nearest).
+/// Error bound: the relative error is at most maxRelativeError() (2^-24) for values within the normal float range
+/// (magnitudes from ~1.2e-38 to ~3.4e38); larger magnitudes become infinity, smaller ones lose relative precision.
+class Float32Quantizer {
+public:
+    typedef float Stored;
+
+    constexpr Float32Quantizer() {}
+
+    float encode(double value) const { return static_cast<float>(value); }
+
+    double decode(float stored) const { return stored; }
+
+    /// Maximum relative error for values within the normal float range
+    constexpr double maxRelativeError() const { return 1.0 / (1 << 24); }
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_QUANTIZER_H
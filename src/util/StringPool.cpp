@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StringPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "flatbuffers/hash.h"
+
+using namespace objectbox;
+
+namespace {
+
+const size_t kMinChunkSize = 64 * 1024;
+
+size_t entrySize(size_t stringSize) {
+    size_t size = offsetof(StringPoolEntry, data) + stringSize + 1;
+    return (size + alignof(StringPoolEntry) - 1) / alignof(StringPoolEntry) * alignof(StringPoolEntry);
+}
+
+}  // namespace
+
+StringPool::Table::Table(size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<const StringPoolEntry*>[capacity]) {
+    for (size_t i = 0; i < capacity; ++i) slots[i].store(nullptr, std::memory_order_relaxed);
+}
+
+StringPool::StringPool(size_t initialCapacity) {
+    size_t capacity = 16;
+    while (capacity < initialCapacity) capacity *= 2;
+    tables_.emplace_back(new Table(capacity));
+    memoryUsage_ = capacity * sizeof(void*);
+    table_.store(tables_.back().get(), std::memory_order_release);
+}
+
+StringPool& StringPool::global() {
+    static StringPool* pool = new StringPool(1024);  // intentionally leaked
+    return *pool;
+}
+
+const StringPoolEntry* StringPool::find(const Table& table, uint64_t hash, const char* text, size_t size) {
+    for (size_t i = hash & table.mask;; i = (i + 1) & table.mask) {
+        const StringPoolEntry* entry = table.slots[i].load(std::memory_order_acquire);
+        if (!entry) return nullptr;
+        if (entry->hash == hash && entry->size == size && memcmp(entry->data, text, size) == 0) return entry;
+    }
+}
+
+void StringPool::insert(Table& table, const StringPoolEntry* entry) {
+    size_t i = entry->hash & table.mask;
+    while (table.slots[i].load(std::memory_order_relaxed)) i = (i + 1) & table.mask;
+    table.slots[i].store(entry, std::memory_order_release);  // publishes the entry's contents to readers
+}
+
+const StringPoolEntry* StringPool::createEntry(uint64_t hash, const char* text, size_t size) {
+    size_t bytes = entrySize(size);
+    if (chunks_.empty() || chunkUsed_ + bytes > chunkSize_) {
+        chunkSize_ = std::max(kMinChunkSize, bytes);
+        chunks_.emplace_back(new char[chunkSize_]);  // new[] of char is suitably aligned for any fundamental type
+        chunkUsed_ = 0;
+        memoryUsage_ += chunkSize_;
+    }
+    StringPoolEntry* entry = reinterpret_cast<StringPoolEntry*>(chunks_.back().get() + chunkUsed_);
+    chunkUsed_ += bytes;
+    entry->hash = hash;
+    entry->size = static_cast<uint32_t>(size);
+    memcpy(entry->data, text, size);
+    entry->data[size] = 0;
+    return entry;
+}
+
+InternedString StringPool::intern(const char* text, size_t size) {
+    uint64_t hash = flatbuffers::HashWyhash64(text, size);
+    const StringPoolEntry* entry = find(*table_.load(std::memory_order_acquire), hash, text, size);
+    if (entry) return InternedString(entry);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Table* table = table_.load(std::memory_order_relaxed);
+    entry = find(*table, hash, text, size);  // another thread may have added it meanwhile
+    if (entry) return InternedString(entry);
+
+    if ((count_ + 1) * 4 > (table->mask + 1) * 3) {  // keep the load factor below 3/4
+        size_t capacity = (table->mask + 1) * 2;
+        tables_.emplace_back(new Table(capacity));
+        Table* grown = tables_.back().get();
+        for (size_t i = 0; i <= table->mask; ++i) {
+            const StringPoolEntry* existing = table->slots[i].load(std::memory_order_relaxed);
+            if (existing) insert(*grown, existing);
+        }
+        memoryUsage_ += capacity * sizeof(void*);
+        table_.store(grown, std::memory_order_release);  // readers still probing the old table will retry locked
+        table = grown;
+    }
+    entry = createEntry(hash, text, size);
+    insert(*table, entry);
+    count_++;
+    return InternedString(entry);
+}
+
+InternedString StringPool::find(const char* text, size_t size) const {
+    uint64_t hash = flatbuffers::HashWyhash64(text, size);
+    return InternedString(find(*table_.load(std::memory_order_acquire), hash, text, size));
+}
+
+size_t StringPool::count() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+size_t StringPool::memoryUsage() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memoryUsage_;
+}
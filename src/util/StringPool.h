@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_STRINGPOOL_H
+#define OBJECTBOX_STRINGPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace objectbox {
+
+struct StringPoolEntry {
+    uint64_t hash;
+    uint32_t size;
+    char data[4];  // actually size + 1 bytes (zero terminated)
+};
+
+/// Handle to an immutable string owned by a StringPool; valid as long as the pool exists (i.e. "forever" for the
+/// global pool). Cheap to copy; strings from the same pool are equal if and only if their handles are equal.
+class InternedString {
+    const StringPoolEntry* entry_ = nullptr;
+
+    friend class StringPool;
+    explicit InternedString(const StringPoolEntry* entry) : entry_(entry) {}
+
+public:
+    InternedString() = default;
+
+    const char* c_str() const { return entry_ ? entry_->data : ""; }
+
+    size_t size() const { return entry_ ? entry_->size : 0; }
+
+    bool empty() const { return size() == 0; }
+
+    std::string str() const { return std::string(c_str(), size()); }
+
+    bool operator==(InternedString other) const { return entry_ == other.entry_; }
+
+    bool operator!=(InternedString other) const { return entry_ != other.entry_; }
+};
+
+/// Interns strings: each distinct string is stored once and never changes or moves until the pool is destroyed.
+/// Thread-safe; looking up strings that are already interned is lock-free (open addressing hash table using
+/// wyhash), only adding new strings takes a lock. Intended for small sets of frequently repeated values like names
+/// and tags; strings are never removed.
+class StringPool {
+    struct Table {
+        size_t mask;
+        std::unique_ptr<std::atomic<const StringPoolEntry*>[]> slots;
+
+        explicit Table(size_t capacity);
+    };
+
+    std::atomic<Table*> table_;
+    std::vector<std::unique_ptr<Table>> tables_;  // incl. outgrown tables, which readers may still be probing
+    std::vector<std::unique_ptr<char[]>> chunks_;  // entry storage
+    size_t chunkUsed_ = 0;
+    size_t chunkSize_ = 0;
+    size_t count_ = 0;
+    size_t memoryUsage_ = 0;
+    std::mutex mutex_;
+
+    static const StringPoolEntry* find(const Table& table, uint64_t hash, const char* text, size_t size);
+    static void insert(Table& table, const StringPoolEntry* entry);
+
+    const StringPoolEntry* createEntry(uint64_t hash, const char* text, size_t size);
+
+public:
+    explicit StringPool(size_t initialCapacity = 64);
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// Process-wide pool; never destroyed, so its strings stay valid even during static destruction
+    static StringPool& global();
+
+    /// @returns the interned (pooled) instance of the given string, adding it to the pool if necessary
+    InternedString intern(const char* text, size_t size);
+
+    InternedString intern(const std::string& text) { return intern(text.data(), text.size()); }
+
+    /// Lock-free lookup without adding
+    /// @returns the interned instance or an empty handle if the string is not in the pool
+    InternedString find(const char* text, size_t size) const;
+
+    /// Number of distinct strings
+    size_t count();
+
+    /// Bytes allocated for strings and hash tables
+    size_t memoryUsage();
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_STRINGPOOL_H
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_STRINGVIEW_H
+#define OBJECTBOX_STRINGVIEW_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#include "flatbuffers/base.h"
+
+namespace objectbox {
+
+/// Non-owning reference to string data, e.g. inside a FlatBuffer; a C++11 stand-in for std::string_view.
+/// Converts to flatbuffers::string_view if that is available (C++17).
+class StringView {
+    const char* data_ = "";
+    size_t size_ = 0;
+
+public:
+    StringView() = default;
+
+    StringView(const char* data, size_t size) : data_(data), size_(size) {}
+
+    StringView(const char* text) : data_(text), size_(strlen(text)) {}
+
+    StringView(const std::string& text) : data_(text.data()), size_(text.size()) {}
+
+    const char* data() const { return data_; }
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    std::string str() const { return std::string(data_, size_); }
+
+    bool operator==(StringView other) const {
+        return size_ == other.size_ && (size_ == 0 || memcmp(data_, other.data_, size_) == 0);
+    }
+
+    bool operator!=(StringView other) const { return !(*this == other); }
+
+#ifdef FLATBUFFERS_HAS_STRING_VIEW
+    operator flatbuffers::string_view() const { return flatbuffers::string_view(data_, size_); }
+#endif
+};
+
+inline std::ostream& operator<<(std::ostream& out, StringView text) { return out.write(text.data(), text.size()); }
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_STRINGVIEW_H
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TextWriter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "FastNumbers.h"
+
+using namespace objectbox;
+
+namespace {
+
+const char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/// Writes exactly 2 digits
+inline void write2(char* out, unsigned value) { memcpy(out, kDigitPairs + 2 * value, 2); }
+
+/// Days since 1970-01-01 to year/month/day in the proleptic Gregorian calendar (H. Hinnant's civil_from_days)
+void civilFromDays(int64_t days, int64_t& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);                               // [0, 146096]
+    unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;  // [0, 399]
+    unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);             // [0, 365]
+    unsigned monthIndex = (5 * dayOfYear + 2) / 153;                                               // [0, 11], March=0
+    day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = static_cast<int64_t>(yearOfEra) + era * 400 + (month <= 2);
+}
+
+}  // namespace
+
+const size_t BufferedTextWriter::kMaxFormattedLength;
+
+BufferedTextWriter::BufferedTextWriter(const std::string& path, size_t bufferSize)
+    : path_(path), buffer_(std::max(bufferSize, kMaxFormattedLength)) {
+    file_ = fopen(path.c_str(), "wb");
+    if (!file_) throw std::runtime_error("Could not create file " + path);
+    setvbuf(file_, nullptr, _IONBF, 0);  // we buffer ourselves
+}
+
+BufferedTextWriter::~BufferedTextWriter() {
+    if (file_) {
+        if (used_) fwrite(buffer_.data(), 1, used_, file_);
+        fclose(file_);
+    }
+}
+
+void BufferedTextWriter::writeToFile(const char* data, size_t size) {
+    if (fwrite(data, 1, size, file_) != size) throw std::runtime_error("Could not write to file " + path_);
+    bytesWritten_ += size;
+}
+
+void BufferedTextWriter::flush() {
+    if (used_ == 0) return;
+    size_t size = used_;
+    used_ = 0;
+    writeToFile(buffer_.data(), size);
+}
+
+void BufferedTextWriter::close() {
+    if (!file_) return;
+    flush();
+    bool ok = fclose(file_) == 0;
+    file_ = nullptr;
+    if (!ok) throw std::runtime_error("Could not finish file " + path_);
+}
+
+size_t BufferedTextWriter::formatInt(int64_t value, char* out) {
+    char* p = out;
+    uint64_t magnitude = static_cast<uint64_t>(value);
+    if (value < 0) {
+        *p++ = '-';
+        magnitude = 0 - magnitude;
+    }
+    char digits[20];
+    char* end = digits + sizeof(digits);
+    char* d = end;
+    while (magnitude >= 100) {
+        d -= 2;
+        write2(d, static_cast<unsigned>(magnitude % 100));
+        magnitude /= 100;
+    }
+    if (magnitude >= 10) {
+        d -= 2;
+        write2(d, static_cast<unsigned>(magnitude));
+    } else {
+        *--d = static_cast<char>('0' + magnitude);
+    }
+    memcpy(p, d, static_cast<size_t>(end - d));
+    return static_cast<size_t>(p - out) + static_cast<size_t>(end - d);
+}
+
+size_t BufferedTextWriter::formatDouble(double value, char* out) { return objectbox::formatDouble(value, out); }
+
+size_t BufferedTextWriter::formatTimestamp(int64_t millisSinceEpoch, char* out) {
+    // Floor division, so times before 1970 work as well
+    int64_t days = millisSinceEpoch / 86400000;
+    int64_t millisOfDay = millisSinceEpoch % 86400000;
+    if (millisOfDay < 0) {
+        millisOfDay += 86400000;
+        days--;
+    }
+    int64_t year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+
+    char* p = out;
+    if (year < 0 || year > 9999) {  // not in ISO 8601 basic range; still unambiguous
+        p += formatInt(year, p);
+    } else {
+        write2(p, static_cast<unsigned>(year / 100));
+        write2(p + 2, static_cast<unsigned>(year % 100));
+        p += 4;
+    }
+    unsigned millis = static_cast<unsigned>(millisOfDay);
+    unsigned seconds = millis / 1000;
+    p[0] = '-';
+    write2(p + 1, month);
+    p[3] = '-';
+    write2(p + 4, day);
+    p[6] = 'T';
+    write2(p + 7, seconds / 3600);
+    p[9] = ':';
+    write2(p + 10, seconds / 60 % 60);
+    p[12] = ':';
+    write2(p + 13, seconds % 60);
+    p[15] = '.';
+    p[16] = static_cast<char>('0' + millis % 1000 / 100);
+    write2(p + 17, millis % 100);
+    p[19] = 'Z';
+    return static_cast<size_t>(p + 20 - out);
+}
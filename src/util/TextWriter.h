@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_TEXTWRITER_H
+#define OBJECTBOX_TEXTWRITER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace objectbox {
+
+/// Writes text to a file through a large buffer; numbers and timestamps are formatted directly into the buffer
+/// (no std::string or stream objects), so it is suitable for exporting millions of rows.
+class BufferedTextWriter {
+    std::string path_;
+    FILE* file_ = nullptr;
+    std::vector<char> buffer_;
+    size_t used_ = 0;
+    uint64_t bytesWritten_ = 0;
+
+    /// Makes sure there are at least size bytes available in the buffer
+    char* reserve(size_t size) {
+        if (used_ + size > buffer_.size()) flush();
+        return buffer_.data() + used_;
+    }
+
+public:
+    /// Maximum length of a formatted number or timestamp
+    static const size_t kMaxFormattedLength = 32;
+
+    /// Creates (or overwrites) the file; throws std::runtime_error on I/O errors (like all other methods)
+    explicit BufferedTextWriter(const std::string& path, size_t bufferSize = 1024 * 1024);
+
+    /// Closes the file if close() was not called; errors are ignored (call close() to get them)
+    ~BufferedTextWriter();
+
+    BufferedTextWriter(const BufferedTextWriter&) = delete;
+    BufferedTextWriter& operator=(const BufferedTextWriter&) = delete;
+
+    void write(char c) {
+        *reserve(1) = c;
+        used_++;
+    }
+
+    void write(const char* text, size_t length) {
+        if (length > buffer_.size()) {
+            flush();
+            writeToFile(text, length);
+        } else {
+            memcpy(reserve(length), text, length);
+            used_ += length;
+        }
+    }
+
+    void write(const char* text) { write(text, strlen(text)); }
+
+    void writeInt(int64_t value) { used_ += formatInt(value, reserve(kMaxFormattedLength)); }
+
+    /// Shortest representation that parses back to the same value; "nan", "inf" or "-inf" if not finite
+    /// (see objectbox::formatDouble())
+    void writeDouble(double value) { used_ += formatDouble(value, reserve(kMaxFormattedLength)); }
+
+    /// ISO 8601 date and time in UTC with milliseconds, e.g. "2026-01-31T23:59:59.999Z"
+    void writeTimestamp(int64_t millisSinceEpoch) {
+        used_ += formatTimestamp(millisSinceEpoch, reserve(kMaxFormattedLength));
+    }
+
+    /// Writes the buffered text to the file
+    void flush();
+
+    /// Flushes and closes the file
+    void close();
+
+    /// Total number of bytes written (including buffered bytes)
+    uint64_t bytesWritten() const { return bytesWritten_ + used_; }
+
+    // Formatting functions write to out (at least kMaxFormattedLength bytes) without a terminating zero and
+    // return the number of characters written.
+    static size_t formatInt(int64_t value, char* out);
+    static size_t formatDouble(double value, char* out);
+    static size_t formatTimestamp(int64_t millisSinceEpoch, char* out);
+
+private:
+    void writeToFile(const char* data, size_t size);
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_TEXTWRITER_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tracing.h"
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace objectbox;
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    const char* argName;
+    int64_t argValue;
+    uint64_t begin;
+    uint64_t end;
+};
+
+/// Owned by the registry (not by the thread), so events of finished threads are kept until written
+struct ThreadBuffer {
+    size_t threadId;
+    std::string name;
+    std::vector<TraceEvent> events;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+Registry& registry() {
+    static Registry* instance = new Registry();  // never destroyed: threads may still record during exit
+    return *instance;
+}
+
+ThreadBuffer& threadBuffer() {
+    static thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.emplace_back(new ThreadBuffer());
+        buffer = reg.buffers.back().get();
+        buffer->threadId = reg.buffers.size();
+        buffer->events.reserve(1024);
+    }
+    return *buffer;
+}
+
+/// Chrome trace timestamps are in microseconds; keeps nanosecond precision with 3 decimals
+void appendMicros(std::string& json, uint64_t nanos) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%llu.%03u", static_cast<unsigned long long>(nanos / 1000),
+             static_cast<unsigned>(nanos % 1000));
+    json += buffer;
+}
+
+/// Escapes quotes and backslashes; names are usually literals, but thread names may come from anywhere
+void appendJsonString(std::string& json, const char* text) {
+    json += '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') json += '\\';
+        if (static_cast<unsigned char>(*c) >= 0x20) json += *c;
+    }
+    json += '"';
+}
+
+}  // namespace
+
+std::atomic<bool> Tracer::enabled_(false);
+
+void Tracer::enable() {
+    registry();  // sets the start time
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+void Tracer::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(registry().mutex);  // the name is read by writeJson()
+    buffer.name = name;
+}
+
+uint64_t Tracer::now() {
+    auto duration = std::chrono::steady_clock::now() - registry().start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+void Tracer::record(const char* name, uint64_t beginNanos, uint64_t endNanos, const char* argName,
+                    int64_t argValue) {
+    threadBuffer().events.push_back(TraceEvent{name, argName, argValue, beginNanos, endNanos});
+}
+
+size_t Tracer::writeJson(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) throw std::runtime_error("Could not create trace file " + path);
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    size_t count = 0;
+    bool ok = fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file) >= 0;
+    std::string json;
+    const char* separator = "\n";
+    for (const std::unique_ptr<ThreadBuffer>& buffer : reg.buffers) {
+        std::string tid = std::to_string(buffer->threadId);
+        std::string threadName = buffer->name.empty() ? "thread " + tid : buffer->name;
+        json = separator;
+        json += "{\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        appendJsonString(json, threadName.c_str());
+        json += "}}";
+        separator = ",\n";
+        for (const TraceEvent& event : buffer->events) {
+            json += ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" + tid + ",\"name\":";
+            appendJsonString(json, event.name);
+            json += ",\"ts\":";
+            appendMicros(json, event.begin);
+            json += ",\"dur\":";
+            appendMicros(json, event.end - event.begin);
+            if (event.argName) {
+                json += ",\"args\":{";
+                appendJsonString(json, event.argName);
+                json += ":" + std::to_string(event.argValue) + "}";
+            }
+            json += "}";
+            if (json.size() >= 1024 * 1024) {
+                ok = ok && fwrite(json.data(), 1, json.size(), file) == json.size();
+                json.clear();
+            }
+        }
+        ok = ok && fwrite(json.data(), 1, json.size(), file) == json.size();
+        count += buffer->events.size();
+        buffer->events.clear();
+    }
+    ok = ok && fputs("\n]}\n", file) >= 0;
+    ok = fclose(file) == 0 && ok;
+    if (!ok) throw std::runtime_error("Could not write trace file " + path);
+    return count;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECTBOX_TRACING_H
+#define OBJECTBOX_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace objectbox {
+
+/// Collects spans (TraceScope) of all threads and writes them as a Chrome trace event JSON file, which can be viewed
+/// as a timeline in chrome://tracing or https://ui.perfetto.dev to see overlap and stalls across threads.
+/// Events are buffered per thread without locking; disabled tracing costs one relaxed atomic load per span.
+class Tracer {
+    static std::atomic<bool> enabled_;
+
+public:
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Starts collecting spans (timestamps are relative to the first start)
+    static void enable();
+
+    /// Stops collecting spans; already collected spans are kept for writeJson()
+    static void disable();
+
+    /// Names the calling thread in the trace (e.g. "serializer 2"); threads are numbered otherwise
+    static void setThreadName(const std::string& name);
+
+    /// Writes all spans collected so far and clears them; threads must not record spans concurrently.
+    /// Throws std::runtime_error if the file cannot be written.
+    /// @returns the number of written spans
+    static size_t writeJson(const std::string& path);
+
+    /// Nanoseconds since the trace started
+    static uint64_t now();
+
+    /// Adds a completed span to the calling thread's buffer; usually called by TraceScope
+    /// @param name must stay valid until writeJson() (e.g. a string literal)
+    static void record(const char* name, uint64_t beginNanos, uint64_t endNanos, const char* argName = nullptr,
+                       int64_t argValue = 0);
+};
+
+/// Records a span from construction to destruction if tracing is enabled:
+///     TraceScope scope("put");
+class TraceScope {
+    const char* name_;
+    const char* argName_;
+    int64_t argValue_;
+    uint64_t begin_;
+
+public:
+    /// @param name and argName must stay valid until Tracer::writeJson() (e.g. string literals)
+    /// @param argName optional; adds an integer argument to the span (e.g. a chunk index or an object count)
+    explicit TraceScope(const char* name, const char* argName = nullptr, int64_t argValue = 0)
+        : name_(Tracer::enabled() ? name : nullptr), argName_(argName), argValue_(argValue),
+          begin_(name_ ? Tracer::now() : 0) {}
+
+    ~TraceScope() {
+        if (name_) Tracer::record(name_, begin_, Tracer::now(), argName_, argValue_);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /// Sets the argument value, e.g. once the object count is known at the end of the span
+    void setArg(const char* argName, int64_t argValue) {
+        argName_ = argName;
+        argValue_ = argValue;
+    }
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_TRACING_H
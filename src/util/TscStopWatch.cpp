@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "TscStopWatch.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if OBX_TSC
+#include <cpuid.h>
+#endif
+
+using namespace objectbox;
+
+std::atomic<int> TscClock::mode_(0);
+double TscClock::nanosPerTick_ = 1;
+double TscClock::ticksPerSecond_ = 1e9;
+
+namespace {
+
+const int64_t kCalibrationNanos = 10 * 1000000;
+
+int64_t steadyNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+#if OBX_TSC
+bool hasInvariantTsc() {
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8))) return true;
+
+    // Hypervisors often hide the flag; Linux only uses the TSC as its clock source if it found it to be reliable
+    FILE* file = fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+    if (!file) return false;
+    char source[32] = {};
+    bool tsc = fgets(source, sizeof(source), file) && strcmp(source, "tsc\n") == 0;
+    fclose(file);
+    return tsc;
+}
+
+/// Reads the TSC and steady_clock as close together as possible (best of a few tries)
+void readBoth(uint64_t& ticks, int64_t& nanos) {
+    int64_t bestWindow = INT64_MAX;
+    for (int i = 0; i < 5; ++i) {
+        int64_t before = steadyNanos();
+        uint64_t tsc = __rdtsc();
+        int64_t after = steadyNanos();
+        if (after - before < bestWindow) {
+            bestWindow = after - before;
+            ticks = tsc;
+            nanos = before + (after - before) / 2;
+        }
+    }
+}
+#endif
+
+}  // namespace
+
+int TscClock::calibrate() {
+    static const int mode = []() {
+        int result = 2;
+#if OBX_TSC
+        if (hasInvariantTsc()) {
+            uint64_t startTicks = 0, endTicks = 0;
+            int64_t startNanos = 0, endNanos = 0;
+            readBoth(startTicks, startNanos);
+            do {
+                readBoth(endTicks, endNanos);
+            } while (endNanos - startNanos < kCalibrationNanos);
+            double rate = static_cast<double>(endTicks - startTicks) * 1e9 / static_cast<double>(endNanos - startNanos);
+            if (endTicks > startTicks && rate > 1e8 && rate < 1e11) {  // plausible: 100 MHz to 100 GHz
+                ticksPerSecond_ = rate;
+                nanosPerTick_ = 1e9 / rate;
+                result = 1;
+            }
+        }
+#endif
+        mode_.store(result, std::memory_order_release);
+        return result;
+    }();
+    return mode;
+}
+
+bool TscClock::usesTsc() { return calibrate() == 1; }
+
+double TscClock::ticksPerSecond() {
+    calibrate();
+    return ticksPerSecond_;
+}
+
+std::string TscClock::description() {
+    if (!usesTsc()) return OBX_TSC ? "steady_clock (no invariant TSC)" : "steady_clock (no TSC support)";
+    char text[64];
+    snprintf(text, sizeof(text), "invariant TSC (%.3f GHz)", ticksPerSecond_ / 1e9);
+    return text;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 ObjectBox Ltd. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef OBJECTBOX_TSCSTOPWATCH_H
+#define OBJECTBOX_TSCSTOPWATCH_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "StopWatch.h"
+
+// The time stamp counter is read via rdtsc (x86 with GCC/Clang); other platforms use steady_clock only
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#include <x86intrin.h>
+#define OBX_TSC 1
+#else
+#define OBX_TSC 0
+#endif
+
+namespace objectbox {
+
+/// Clock reading the CPU's time stamp counter (TSC), which takes a few nanoseconds instead of the tens of nanoseconds
+/// of steady_clock::now(). It is only used if it is invariant (constant rate, not stopped in sleep states; from cpuid,
+/// or if Linux uses it as its clock source, e.g. in VMs hiding the cpuid flag) and its rate can be calibrated against
+/// steady_clock; otherwise ticks are steady_clock nanoseconds. Calibration busy-waits ~10 ms on first use.
+/// rdtsc is not serializing, so a reading may be reordered by some cycles: fine for durations of 100 ns and more.
+class TscClock {
+    static std::atomic<int> mode_;  // 0: not calibrated yet, 1: TSC, 2: steady_clock
+    static double nanosPerTick_;
+    static double ticksPerSecond_;
+
+    static int calibrate();
+
+public:
+    /// Current ticks; only meaningful as a difference to other ticks (of any thread)
+    static uint64_t now() {
+        int mode = mode_.load(std::memory_order_acquire);
+        if (mode == 0) mode = calibrate();
+#if OBX_TSC
+        if (mode == 1) return __rdtsc();
+#endif
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    static uint64_t ticksToNanos(uint64_t ticks) {
+        if (mode_.load(std::memory_order_acquire) == 0) calibrate();
+        return static_cast<uint64_t>(static_cast<double>(ticks) * nanosPerTick_);
+    }
+
+    /// True if ticks come from the TSC (calibrates if not done yet)
+    static bool usesTsc();
+
+    /// Calibrated TSC rate (ticks per second) or 1e9 if steady_clock is used
+    static double ticksPerSecond();
+
+    /// For logs, e.g. "invariant TSC (2.995 GHz)" or "steady_clock (no invariant TSC)"
+    static std::string description();
+};
+
+/// StopWatch using TscClock, e.g. to time single objects in decode loops; same interface as StopWatch.
+class TscStopWatch {
+    uint64_t start_ = TscClock::now();
+
+public:
+    /// Sets the start time to now
+    TscStopWatch() = default;
+
+    /// Sets the start time to now
+    void reset() { start_ = TscClock::now(); }
+
+    /// Duration from start time until now in TscClock ticks (cheapest; convert later with TscClock::ticksToNanos())
+    uint64_t durationInTicks() const { return TscClock::now() - start_; }
+
+    /// Duration from start time until now
+    uint64_t durationInNanos() const { return TscClock::ticksToNanos(durationInTicks()); }
+
+    /// Duration from start time until now
+    uint64_t durationInMicros() const { return durationInNanos() / 1000; }
+
+    /// Duration from start time until now
+    uint64_t durationInMillis() const { return durationInNanos() / 1000000; }
+
+    /// Duration from start time until now in a format appropriate to log (e.g. 5 ms, 0.031 ms, 987 ns)
+    std::string durationForLog() const { return StopWatch::durationForLog(durationInNanos()); }
+
+    static std::string durationForLog(uint64_t durationInNanos) { return StopWatch::durationForLog(durationInNanos); }
+};
+
+}  // namespace objectbox
+
+#endif  // OBJECTBOX_TSCSTOPWATCH_H